@@ -0,0 +1,116 @@
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+# include <cstdio>
+# include <cstdlib>
+# include <sys/resource.h>
+# include <sys/time.h>
+# include <sys/wait.h>
+# include <unistd.h>
+
+//SMALL HELPERS SHARED BY THE BENCHMARKS (timing, memory, output)
+namespace bench
+{
+	inline double	now()
+	{
+		struct timeval	tv;
+
+		gettimeofday(&tv, 0);
+		return (tv.tv_sec + tv.tv_usec / 1e6);
+	}
+
+	//Resident set size right now, in KiB (linux only, 0 elsewhere)
+	inline long	current_rss_kb()
+	{
+		long	pages = 0;
+		long	resident = 0;
+		FILE	*f = fopen("/proc/self/statm", "r");
+
+		if (f == 0)
+			return (0);
+		if (fscanf(f, "%ld %ld", &pages, &resident) != 2)
+			resident = 0;
+		fclose(f);
+		return (resident * (sysconf(_SC_PAGESIZE) / 1024));
+	}
+
+	//Peak resident set size of the process, in KiB
+	inline long	peak_rss_kb()
+	{
+		struct rusage	usage;
+
+		getrusage(RUSAGE_SELF, &usage);
+		return (usage.ru_maxrss);
+	}
+
+	template<typename T>
+	struct Sink
+	{ static volatile unsigned char	byte; };
+
+	template<typename T>
+	volatile unsigned char	Sink<T>::byte;
+
+	//Keeps the compiler from discarding a computed value: the empty asm
+	//may read value through its address, so it must be computed and stored.
+	//Elsewhere its bytes are read into a volatile sink
+	template<typename T>
+	inline void	keep(const T &value)
+	{
+# if defined(__GNUC__)
+		__asm__ __volatile__("" : : "r"(&value) : "memory");
+# else
+		const unsigned char	*bytes = reinterpret_cast<const unsigned char *>(&value);
+
+		for (size_t i = 0; i < sizeof(T); ++i)
+			Sink<T>::byte = bytes[i];
+# endif
+	}
+
+	inline void	report(const char *name, double seconds, double ops)
+	{
+		printf("%-44s %10.3f ms %14.0f ops/s\n", name, seconds * 1e3,
+			seconds > 0 ? ops / seconds : 0);
+	}
+
+	inline void	report_mem(const char *name, long kb)
+	{ printf("%-44s %10ld KiB\n", name, kb); }
+
+	//Fixed seed LCG so every run (and every container) sees the same keys
+	struct Random
+	{
+		unsigned long	state;
+
+		explicit Random(unsigned long seed = 42) : state(seed) {}
+
+		unsigned int	operator()()
+		{
+			state = state * 6364136223846793005UL + 1442695040888963407UL;
+			return (static_cast<unsigned int>(state >> 33));
+		}
+	};
+
+	//Runs fn in a child process so peak RSS is not polluted by earlier runs
+	inline void	isolated(void (*fn)(size_t), size_t n)
+	{
+		pid_t	pid;
+		int		status;
+
+		fflush(stdout);
+		pid = fork();
+		if (pid == 0)
+		{
+			fn(n);
+			fflush(stdout);
+			_exit(0);
+		}
+		if (pid > 0)
+			waitpid(pid, &status, 0);
+		else
+			fn(n);
+	}
+
+	inline size_t	arg_size(int argc, char **argv, size_t def)
+	{ return (argc > 1 ? static_cast<size_t>(atol(argv[1])) : def); }
+}
+
+#endif
@@ -0,0 +1,85 @@
+// ft::btree_map vs ft::map (Rb_tree): random inserts, random lookups (half
+// misses), sorted appends through end() hints and full in-order scans.
+// c++ -O2 -std=c++98 -I.. btree_map.cpp -o btree_map && ./btree_map [count]
+#include <vector>
+#include "map.hpp"
+#include "btree_map.hpp"
+#include "bench.hpp"
+
+typedef ft::pair<int, int>	pair_type;
+
+enum { lookups = 5000000, scans = 20 };
+
+static std::vector<int>	keys;
+static std::vector<int>	probes;
+
+template<typename Map>
+static void	run(const char *name, size_t n)
+{
+	char	label[128];
+	double	t = bench::now();
+	Map		m;
+
+	for (size_t i = 0; i < n; ++i)
+		m.insert(pair_type(keys[i], static_cast<int>(i)));
+	snprintf(label, sizeof(label), "%s random insert", name);
+	bench::report(label, bench::now() - t, n);
+	bench::report_mem(name, bench::current_rss_kb());
+
+	size_t	found = 0;
+
+	t = bench::now();
+	for (size_t i = 0; i < lookups; ++i)
+		found += (m.find(probes[i]) != m.end());
+	snprintf(label, sizeof(label), "%s find", name);
+	bench::report(label, bench::now() - t, lookups);
+	bench::keep(found);
+
+	long	sum = 0;
+
+	t = bench::now();
+	for (size_t i = 0; i < scans; ++i)
+		for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+	snprintf(label, sizeof(label), "%s scan", name);
+	bench::report(label, bench::now() - t, static_cast<double>(n) * scans);
+	bench::keep(sum);
+
+	Map	sorted;
+
+	t = bench::now();
+	for (size_t i = 0; i < n; ++i)
+		sorted.insert(sorted.end(), pair_type(static_cast<int>(i), 0));
+	snprintf(label, sizeof(label), "%s sorted insert at end()", name);
+	bench::report(label, bench::now() - t, n);
+
+	t = bench::now();
+	for (size_t i = 0; i < n; ++i)
+		m.erase(keys[i]);
+	snprintf(label, sizeof(label), "%s random erase", name);
+	bench::report(label, bench::now() - t, n);
+}
+
+static void	run_map(size_t n)
+{ run<ft::map<int, int> >("ft::map", n); }
+
+static void	run_btree_map(size_t n)
+{ run<ft::btree_map<int, int> >("ft::btree_map", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 1000000);
+	bench::Random	rnd;
+
+	printf("<int, int>, %lu elements, %d lookups (half misses), %d scans, %d byte nodes\n",
+		static_cast<unsigned long>(n), lookups, scans, FT_BTREE_NODE_BYTES);
+	keys.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		keys[i] = static_cast<int>(rnd() % (n * 4));
+	probes.resize(lookups);
+	for (size_t i = 0; i < lookups; ++i)
+		probes[i] = (i % 2) ? keys[rnd() % n] : static_cast<int>(rnd() % (n * 4));
+	bench::isolated(run_map, n);
+	bench::isolated(run_btree_map, n);
+	return (0);
+}
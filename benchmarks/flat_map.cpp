@@ -0,0 +1,70 @@
+// ft::flat_map vs ft::map: bulk build, random lookups (hits and misses)
+// and full in-order scans over the same keys.
+// c++ -O2 -std=c++98 -I.. flat_map.cpp -o flat_map && ./flat_map [count]
+#include <algorithm>
+#include <vector>
+#include "map.hpp"
+#include "flat_map.hpp"
+#include "bench.hpp"
+
+typedef ft::pair<int, int>	pair_type;
+
+enum { lookups = 5000000, scans = 20 };
+
+static std::vector<pair_type>	input;
+static std::vector<int>			probes;
+
+template<typename Map>
+static void	run(const char *name, size_t n)
+{
+	char	label[128];
+	double	t = bench::now();
+	Map		m(input.begin(), input.end());
+
+	snprintf(label, sizeof(label), "%s build", name);
+	bench::report(label, bench::now() - t, n);
+
+	size_t	found = 0;
+
+	t = bench::now();
+	for (size_t i = 0; i < lookups; ++i)
+		found += (m.find(probes[i]) != m.end());
+	snprintf(label, sizeof(label), "%s find", name);
+	bench::report(label, bench::now() - t, lookups);
+	bench::keep(found);
+
+	long	sum = 0;
+
+	t = bench::now();
+	for (size_t i = 0; i < scans; ++i)
+		for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+	snprintf(label, sizeof(label), "%s scan", name);
+	bench::report(label, bench::now() - t, static_cast<double>(n) * scans);
+	bench::keep(sum);
+	bench::report_mem(name, bench::current_rss_kb());
+}
+
+static void	run_map(size_t n)
+{ run<ft::map<int, int> >("ft::map", n); }
+
+static void	run_flat_map(size_t n)
+{ run<ft::flat_map<int, int> >("ft::flat_map", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 1000000);
+	bench::Random	rnd;
+
+	printf("<int, int>, %lu elements, %d lookups (half misses), %d scans\n",
+		static_cast<unsigned long>(n), lookups, scans);
+	input.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		input[i] = pair_type(static_cast<int>(rnd() % (n * 4)), static_cast<int>(i));
+	probes.resize(lookups);
+	for (size_t i = 0; i < lookups; ++i)
+		probes[i] = (i % 2) ? input[rnd() % n].first : static_cast<int>(rnd() % (n * 4));
+	bench::isolated(run_map, n);
+	bench::isolated(run_flat_map, n);
+	return (0);
+}
@@ -0,0 +1,187 @@
+// Churn-heavy list workloads, std::list vs ft::list (nodes reused by the
+// list) vs ft::list with ft::pool_allocator: FIFO push_back/pop_front,
+// filter and refill (remove_if then push_back), LRU move-to-front through
+// splice, and sort.
+// c++ -O2 -std=c++98 -I.. list_churn.cpp -o list_churn && ./list_churn [count]
+#include <list>
+#include <vector>
+#include "list.hpp"
+#include "ft_pool_allocator.hpp"
+#include "bench.hpp"
+
+//Drops about half of the elements, a different half every round
+struct Has_bit
+{
+	unsigned	bit;
+
+	explicit Has_bit(unsigned b) : bit(b) {}
+
+	bool	operator()(long x) const
+	{ return ((x >> bit) & 1); }
+};
+
+//Queue of 1000 elements: every operation pushes one and pops one
+template<typename List>
+static void	fifo(const char *name, size_t n)
+{
+	List	l;
+	long	sum = 0;
+	double	t;
+
+	for (long i = 0; i < 1000; ++i)
+		l.push_back(i);
+	t = bench::now();
+	for (size_t i = 0; i < n; ++i)
+	{
+		l.push_back(static_cast<long>(i));
+		sum += l.front();
+		l.pop_front();
+	}
+	bench::report(name, bench::now() - t, static_cast<double>(n));
+	bench::keep(sum);
+}
+
+//100k elements, half of them dropped by remove_if then pushed back
+//(counted by hand, std::list::size() is linear in C++98)
+template<typename List>
+static void	filter_refill(const char *name, size_t n)
+{
+	List			l;
+	bench::Random	rnd;
+	size_t			ops = 0;
+	unsigned		round = 0;
+	double			t;
+
+	for (size_t i = 0; i < 100000; ++i)
+		l.push_back(rnd());
+	t = bench::now();
+	while (ops < n)
+	{
+		size_t	size = 0;
+
+		l.remove_if(Has_bit(round++ % 31));
+		for (typename List::iterator it = l.begin(); it != l.end(); ++it)
+			++size;
+		for (; size < 100000; ++size, ++ops)
+			l.push_back(rnd());
+	}
+	bench::report(name, bench::now() - t, static_cast<double>(ops));
+	bench::keep(l.back());
+}
+
+//Cache of 10k keys, a hit moves its node to the front, a miss evicts the
+//back node and inserts at the front
+template<typename List>
+static void	lru(const char *name, size_t n)
+{
+	typedef typename List::iterator	iterator;
+
+	List					l;
+	std::vector<iterator>	where(100000, l.end());
+	bench::Random			rnd;
+	size_t					size = 0;
+	long					hits = 0;
+	double					t;
+
+	t = bench::now();
+	for (size_t i = 0; i < n; ++i)
+	{
+		const long	key = rnd() % 100000 / (rnd() % 8 + 1);
+
+		if (where[key] != l.end())
+		{
+			l.splice(l.begin(), l, where[key]);
+			++hits;
+		}
+		else
+		{
+			if (size == 10000)
+			{
+				where[l.back()] = l.end();
+				l.pop_back();
+				--size;
+			}
+			l.push_front(key);
+			++size;
+			where[key] = l.begin();
+		}
+	}
+	bench::report(name, bench::now() - t, static_cast<double>(n));
+	bench::keep(hits);
+}
+
+template<typename List>
+static void	sort(const char *name, size_t n)
+{
+	List			l;
+	bench::Random	rnd;
+	double			t;
+
+	for (size_t i = 0; i < n / 10; ++i)
+		l.push_back(rnd());
+	t = bench::now();
+	l.sort();
+	bench::report(name, bench::now() - t, static_cast<double>(n / 10));
+	bench::keep(l.front());
+}
+
+typedef std::list<long>									Std_list;
+typedef ft::list<long>									Ft_list;
+typedef ft::list<long, ft::pool_allocator<long> >		Pool_list;
+
+static void	fifo_std(size_t n)
+{ fifo<Std_list>("fifo std::list", n); }
+
+static void	fifo_ft(size_t n)
+{ fifo<Ft_list>("fifo ft::list", n); }
+
+static void	fifo_pool(size_t n)
+{ fifo<Pool_list>("fifo ft::list<pool_allocator>", n); }
+
+static void	filter_std(size_t n)
+{ filter_refill<Std_list>("remove_if/refill std::list", n); }
+
+static void	filter_ft(size_t n)
+{ filter_refill<Ft_list>("remove_if/refill ft::list", n); }
+
+static void	filter_pool(size_t n)
+{ filter_refill<Pool_list>("remove_if/refill ft::list<pool_allocator>", n); }
+
+static void	lru_std(size_t n)
+{ lru<Std_list>("lru std::list", n); }
+
+static void	lru_ft(size_t n)
+{ lru<Ft_list>("lru ft::list", n); }
+
+static void	lru_pool(size_t n)
+{ lru<Pool_list>("lru ft::list<pool_allocator>", n); }
+
+static void	sort_std(size_t n)
+{ sort<Std_list>("sort std::list", n); }
+
+static void	sort_ft(size_t n)
+{ sort<Ft_list>("sort ft::list", n); }
+
+static void	sort_pool(size_t n)
+{ sort<Pool_list>("sort ft::list<pool_allocator>", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 10000000);
+
+	printf("%lu operations (sort: %lu elements)\n", static_cast<unsigned long>(n),
+		static_cast<unsigned long>(n / 10));
+	bench::isolated(fifo_std, n);
+	bench::isolated(fifo_ft, n);
+	bench::isolated(fifo_pool, n);
+	bench::isolated(filter_std, n);
+	bench::isolated(filter_ft, n);
+	bench::isolated(filter_pool, n);
+	bench::isolated(lru_std, n);
+	bench::isolated(lru_ft, n);
+	bench::isolated(lru_pool, n);
+	bench::isolated(sort_std, n);
+	bench::isolated(sort_ft, n);
+	bench::isolated(sort_pool, n);
+	return (0);
+}
@@ -0,0 +1,59 @@
+// Repeated assignment of large ft::map<int, int>: node reuse in operator=
+// vs clearing first (every node freed then allocated again).
+// c++ -O2 -std=c++98 -I.. map_assign.cpp -o map_assign && ./map_assign [count]
+#include "map.hpp"
+#include "bench.hpp"
+
+static const int	rounds = 10;
+
+static ft::map<int, int>	src_a;
+static ft::map<int, int>	src_b;
+
+static void	fill(ft::map<int, int> &m, size_t n, unsigned long seed)
+{
+	bench::Random	rnd(seed);
+
+	while (m.size() < n)
+		m.insert(ft::make_pair(static_cast<int>(rnd()), static_cast<int>(m.size())));
+}
+
+static void	assign_reuse(size_t n)
+{
+	ft::map<int, int>	dst(src_a);
+	double				t = bench::now();
+
+	for (int i = 0; i < rounds; ++i)
+	{
+		dst = src_b;
+		dst = src_a;
+	}
+	bench::report("operator= (node reuse)", bench::now() - t, 2.0 * rounds * n);
+}
+
+static void	assign_clear(size_t n)
+{
+	ft::map<int, int>	dst(src_a);
+	double				t = bench::now();
+
+	for (int i = 0; i < rounds; ++i)
+	{
+		dst.clear();
+		dst = src_b;
+		dst.clear();
+		dst = src_a;
+	}
+	bench::report("clear() then operator=", bench::now() - t, 2.0 * rounds * n);
+}
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 1000000);
+
+	printf("ft::map<int, int>, %lu elements, %d x 2 assignments\n",
+		static_cast<unsigned long>(n), rounds);
+	fill(src_a, n, 1);
+	fill(src_b, n, 2);
+	bench::isolated(assign_clear, n);
+	bench::isolated(assign_reuse, n);
+	return (0);
+}
@@ -0,0 +1,117 @@
+// Builds and discards many small ft::map<int, int> (one per simulated
+// request), std::allocator vs ft::pool_allocator vs ft::monotonic_allocator
+// on a heap arena and on a stack buffer. ops/s is maps per second.
+// c++ -O2 -std=c++98 -I.. monotonic_allocator.cpp -o monotonic_allocator && ./monotonic_allocator [count]
+#include <memory>
+#include <vector>
+#include "map.hpp"
+#include "ft_pool_allocator.hpp"
+#include "ft_monotonic_allocator.hpp"
+#include "bench.hpp"
+
+static const size_t	map_size = 16;
+
+static std::vector<int>	g_keys;
+
+static void	make_keys(size_t n)
+{
+	bench::Random	rnd;
+
+	g_keys.resize(n * map_size);
+	for (size_t i = 0; i < g_keys.size(); ++i)
+		g_keys[i] = static_cast<int>(rnd() % 1000);
+}
+
+//One request: fill a map from its keys
+template<typename Map>
+static long	request(Map &m, size_t r)
+{
+	const int	*keys = &g_keys[r * map_size];
+
+	for (size_t i = 0; i < map_size; ++i)
+		m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	return (static_cast<long>(m.size()));
+}
+
+template<typename Alloc>
+static void	run(const char *name, size_t n)
+{
+	typedef ft::map<int, int, std::less<int>, Alloc>	map_type;
+	long		sum = 0;
+	double		t = bench::now();
+
+	for (size_t r = 0; r < n; ++r)
+	{
+		map_type	m;
+
+		sum += request(m, r);
+	}
+	bench::report(name, bench::now() - t, n);
+	bench::keep(sum);
+}
+
+static void	run_std(size_t n)
+{ run<std::allocator<ft::pair<const int, int> > >("std::allocator", n); }
+
+static void	run_pool(size_t n)
+{ run<ft::pool_allocator<ft::pair<const int, int> > >("ft::pool_allocator", n); }
+
+typedef ft::monotonic_allocator<ft::pair<const int, int> >			arena_alloc;
+typedef ft::map<int, int, std::less<int>, arena_alloc>				arena_map;
+
+//The arena outlives the requests and is released after each one, so its
+//first block is reused only when it comes from a caller buffer
+static void	run_arena(size_t n)
+{
+	std::less<int>	comp;
+	ft::arena		ar;
+	long			sum = 0;
+	double			t = bench::now();
+
+	for (size_t r = 0; r < n; ++r)
+	{
+		{
+			arena_map	m(comp, arena_alloc(ar));
+
+			sum += request(m, r);
+		}
+		ar.release();
+	}
+	bench::report("ft::monotonic_allocator (heap arena)", bench::now() - t, n);
+	bench::keep(sum);
+}
+
+static void	run_buffer(size_t n)
+{
+	std::less<int>	comp;
+	char			buffer[4096];
+	ft::arena		ar(buffer, sizeof(buffer));
+	long			sum = 0;
+	double			t = bench::now();
+
+	for (size_t r = 0; r < n; ++r)
+	{
+		{
+			arena_map	m(comp, arena_alloc(ar));
+
+			sum += request(m, r);
+		}
+		ar.release();
+	}
+	bench::report("ft::monotonic_allocator (stack buffer)", bench::now() - t, n);
+	bench::keep(sum);
+}
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 100000);
+
+	make_keys(n);
+	printf("%lu ft::map<int, int> of %lu insertions each\n",
+		static_cast<unsigned long>(n), static_cast<unsigned long>(map_size));
+	bench::isolated(run_std, n);
+	bench::isolated(run_pool, n);
+	bench::isolated(run_arena, n);
+	bench::isolated(run_buffer, n);
+	return (0);
+}
@@ -0,0 +1,60 @@
+// Appending an event log to a multimap keyed by timestamp, many events
+// sharing each timestamp: insert(end(), v) (no search once the tree knows
+// the key is not lesser than its last one) vs insert(v), std::multimap vs
+// ft::multimap, then count() over every timestamp.
+// c++ -O2 -std=c++98 -I.. multimap_equal.cpp -o multimap_equal && ./multimap_equal [count]
+#include <map>
+#include "multimap.hpp"
+#include "bench.hpp"
+
+//Events per timestamp
+static const int	run = 64;
+
+template<typename Multimap, typename Pair>
+static void	append(const char *name, size_t n, bool hinted)
+{
+	Multimap	m;
+	double		t = bench::now();
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (hinted)
+			m.insert(m.end(), Pair(static_cast<int>(i / run), static_cast<int>(i)));
+		else
+			m.insert(Pair(static_cast<int>(i / run), static_cast<int>(i)));
+	}
+	bench::report(name, bench::now() - t, n);
+
+	size_t	total = 0;
+
+	t = bench::now();
+	for (size_t k = 0; k < n / run; ++k)
+		total += m.count(static_cast<int>(k));
+	bench::report("  count() per timestamp", bench::now() - t, n / run);
+	bench::keep(total);
+}
+
+static void	std_hinted(size_t n)
+{ append<std::multimap<int, int>, std::pair<int, int> >("std::multimap insert(end(), v)", n, true); }
+
+static void	std_plain(size_t n)
+{ append<std::multimap<int, int>, std::pair<int, int> >("std::multimap insert(v)", n, false); }
+
+static void	ft_hinted(size_t n)
+{ append<ft::multimap<int, int>, ft::pair<int, int> >("ft::multimap insert(end(), v)", n, true); }
+
+static void	ft_plain(size_t n)
+{ append<ft::multimap<int, int>, ft::pair<int, int> >("ft::multimap insert(v)", n, false); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 5000000);
+
+	printf("multimap<int, int>, %lu events, %d per timestamp\n",
+		static_cast<unsigned long>(n), run);
+	bench::isolated(std_hinted, n);
+	bench::isolated(ft_hinted, n);
+	bench::isolated(std_plain, n);
+	bench::isolated(ft_plain, n);
+	return (0);
+}
@@ -0,0 +1,66 @@
+// Insert/erase throughput and memory of ft::map<int, int> with the default
+// allocator vs ft::pool_allocator.
+// c++ -O2 -std=c++98 -I.. pool_allocator.cpp -o pool_allocator && ./pool_allocator [count]
+#include <memory>
+#include <vector>
+#include "map.hpp"
+#include "ft_pool_allocator.hpp"
+#include "bench.hpp"
+
+template<typename Alloc>
+static void	run(const char *name, size_t n)
+{
+	typedef ft::map<int, int, std::less<int>, Alloc>	map_type;
+	std::vector<int>	keys(n);
+	bench::Random		rnd;
+	char				label[128];
+
+	for (size_t i = 0; i < n; ++i)
+		keys[i] = static_cast<int>(rnd());
+	const long	rss_before = bench::current_rss_kb();
+	{
+		map_type	m;
+		double		t = bench::now();
+
+		for (size_t i = 0; i < n; ++i)
+			m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+		snprintf(label, sizeof(label), "%s insert", name);
+		bench::report(label, bench::now() - t, n);
+		snprintf(label, sizeof(label), "%s rss growth", name);
+		bench::report_mem(label, bench::current_rss_kb() - rss_before);
+
+		//erase half, insert again: nodes are recycled from the free list
+		t = bench::now();
+		for (size_t i = 0; i < n; i += 2)
+			m.erase(keys[i]);
+		for (size_t i = 0; i < n; i += 2)
+			m.insert(ft::make_pair(keys[i] + 1, static_cast<int>(i)));
+		snprintf(label, sizeof(label), "%s churn (erase+insert n/2)", name);
+		bench::report(label, bench::now() - t, n);
+
+		t = bench::now();
+		for (size_t i = 0; i < n; ++i)
+			m.erase(keys[i]);
+		m.clear();
+		snprintf(label, sizeof(label), "%s erase", name);
+		bench::report(label, bench::now() - t, n);
+	}
+	snprintf(label, sizeof(label), "%s peak rss", name);
+	bench::report_mem(label, bench::peak_rss_kb());
+}
+
+static void	run_std(size_t n)
+{ run<std::allocator<ft::pair<const int, int> > >("std::allocator", n); }
+
+static void	run_pool(size_t n)
+{ run<ft::pool_allocator<ft::pair<const int, int> > >("ft::pool_allocator", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 1000000);
+
+	printf("ft::map<int, int>, %lu elements\n", static_cast<unsigned long>(n));
+	bench::isolated(run_std, n);
+	bench::isolated(run_pool, n);
+	return (0);
+}
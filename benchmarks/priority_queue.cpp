@@ -0,0 +1,84 @@
+// Priority queue push and pop throughput for 1M, 10M and 100M random ints
+// (up to the argument): std::priority_queue vs ft::priority_queue with a
+// binary, 4-ary and 8-ary heap, and 4-ary filled by push_range (O(n) build).
+// c++ -O2 -std=c++98 -I.. priority_queue.cpp -o priority_queue && ./priority_queue [max count]
+#include <queue>
+#include <vector>
+#include "queue.hpp"
+#include "bench.hpp"
+
+template<typename Queue>
+static void	run(const char *name, size_t n)
+{
+	Queue			q;
+	bench::Random	rnd;
+	long			sum = 0;
+	double			t = bench::now();
+	char			label[64];
+
+	for (size_t i = 0; i < n; ++i)
+		q.push(static_cast<int>(rnd()));
+	snprintf(label, sizeof(label), "%s push", name);
+	bench::report(label, bench::now() - t, static_cast<double>(n));
+	t = bench::now();
+	while (!q.empty())
+	{
+		sum += q.top();
+		q.pop();
+	}
+	snprintf(label, sizeof(label), "%s pop", name);
+	bench::report(label, bench::now() - t, static_cast<double>(n));
+	bench::keep(sum);
+}
+
+static void	run_push_range(size_t n)
+{
+	ft::priority_queue<int>	q;
+	ft::vector<int>			src;
+	bench::Random			rnd;
+	long					sum = 0;
+	double					t;
+
+	src.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+		src.push_back(static_cast<int>(rnd()));
+	t = bench::now();
+	q.push_range(src.begin(), src.end());
+	bench::report("ft 4-ary push_range", bench::now() - t, static_cast<double>(n));
+	t = bench::now();
+	while (!q.empty())
+	{
+		sum += q.top();
+		q.pop();
+	}
+	bench::report("ft 4-ary pop", bench::now() - t, static_cast<double>(n));
+	bench::keep(sum);
+}
+
+static void	run_std(size_t n)
+{ run<std::priority_queue<int> >("std::priority_queue", n); }
+
+static void	run_ft2(size_t n)
+{ run<ft::priority_queue<int, ft::vector<int>, std::less<int>, 2> >("ft 2-ary", n); }
+
+static void	run_ft4(size_t n)
+{ run<ft::priority_queue<int> >("ft 4-ary", n); }
+
+static void	run_ft8(size_t n)
+{ run<ft::priority_queue<int, ft::vector<int>, std::less<int>, 8> >("ft 8-ary", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	max = bench::arg_size(argc, argv, 100000000);
+
+	for (size_t n = 1000000; n <= max; n *= 10)
+	{
+		printf("%lu ints\n", static_cast<unsigned long>(n));
+		bench::isolated(run_std, n);
+		bench::isolated(run_ft2, n);
+		bench::isolated(run_ft4, n);
+		bench::isolated(run_ft8, n);
+		bench::isolated(run_push_range, n);
+	}
+	return (0);
+}
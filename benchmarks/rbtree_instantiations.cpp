@@ -0,0 +1,73 @@
+// 50 distinct ft::map instantiations used round-robin, the shape of a service
+// juggling dozens of map types: each one inserts, looks up and erases a few
+// keys in turn, so the code of all 50 competes for the instruction cache.
+// Also the file to measure compile time and text size of the tree code on:
+// time c++ -O2 -std=c++98 -I.. rbtree_instantiations.cpp -o rbtree_instantiations && size rbtree_instantiations
+// c++ -O2 -std=c++98 -I.. rbtree_instantiations.cpp -o rbtree_instantiations && ./rbtree_instantiations [rounds]
+#include "map.hpp"
+#include "bench.hpp"
+
+static const int	types = 50;
+
+//One key type per instantiation
+template<int N>
+struct Key
+{
+	int	v;
+
+	Key(int x = 0) : v(x) {}
+
+	bool	operator<(const Key &k) const
+	{ return (v < k.v); }
+};
+
+//Every round each map gets 8 inserts, 8 lookups and 8 erasures around a
+//steady size of 1000 elements
+template<int N>
+struct Instances
+{
+	static long	step(unsigned seed)
+	{
+		static ft::map<Key<N>, int>	m;
+		long						found = 0;
+
+		for (unsigned i = 0; i < 8; ++i)
+		{
+			const int	k = static_cast<int>((seed + i * 2654435761u) % 2000);
+
+			m.insert(ft::make_pair(Key<N>(k), k));
+			found += (m.find(Key<N>(k ^ 1)) != m.end());
+			if (m.size() > 1000)
+				m.erase(m.begin());
+		}
+		return (found + Instances<N - 1>::step(seed * 31 + 7));
+	}
+};
+
+template<>
+struct Instances<0>
+{
+	static long	step(unsigned)
+	{ return (0); }
+};
+
+static void	run(size_t rounds)
+{
+	long	found = 0;
+	double	t = bench::now();
+
+	for (size_t r = 0; r < rounds; ++r)
+		found += Instances<types>::step(static_cast<unsigned>(r));
+	bench::report("50 maps, insert + find + erase round-robin", bench::now() - t,
+		static_cast<double>(rounds) * types * 8);
+	bench::keep(found);
+}
+
+int	main(int argc, char **argv)
+{
+	const size_t	rounds = bench::arg_size(argc, argv, 50000);
+
+	printf("%d ft::map instantiations, %lu rounds\n", types, static_cast<unsigned long>(rounds));
+	bench::isolated(run, rounds);
+	return (0);
+}
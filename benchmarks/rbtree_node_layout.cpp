@@ -0,0 +1,67 @@
+// Red-black tree node size and ft::map<int, int> footprint at 10M elements,
+// to run once as is and once with -DFT_RB_TREE_COMPACT_NODE (color in the
+// parent pointer, value last). Inserts and lookups are timed too since every
+// parent/color access then masks a bit.
+// c++ -O2 -std=c++98 -I.. [-DFT_RB_TREE_COMPACT_NODE] rbtree_node_layout.cpp -o rbtree_node_layout && ./rbtree_node_layout [count]
+#include <memory>
+#include <vector>
+#include "map.hpp"
+#include "ft_pool_allocator.hpp"
+#include "bench.hpp"
+
+static std::vector<int>	keys;
+
+template<typename Alloc>
+static void	run(const char *name, size_t n)
+{
+	typedef ft::map<int, int, std::less<int>, Alloc>	map_type;
+	char		label[128];
+	const long	rss_before = bench::current_rss_kb();
+	map_type	m;
+	double		t = bench::now();
+
+	for (size_t i = 0; i < n; ++i)
+		m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	snprintf(label, sizeof(label), "%s insert", name);
+	bench::report(label, bench::now() - t, n);
+	snprintf(label, sizeof(label), "%s rss growth", name);
+	bench::report_mem(label, bench::current_rss_kb() - rss_before);
+
+	size_t	found = 0;
+
+	t = bench::now();
+	for (size_t i = 0; i < n; ++i)
+		found += (m.find(keys[i] ^ 1) != m.end());
+	snprintf(label, sizeof(label), "%s find", name);
+	bench::report(label, bench::now() - t, n);
+	bench::keep(found);
+}
+
+static void	std_alloc(size_t n)
+{ run<std::allocator<ft::pair<const int, int> > >("std::allocator", n); }
+
+static void	pool_alloc(size_t n)
+{ run<ft::pool_allocator<ft::pair<const int, int> > >("ft::pool_allocator", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 10000000);
+	bench::Random	rnd;
+
+# ifdef FT_RB_TREE_COMPACT_NODE
+	printf("compact nodes (FT_RB_TREE_COMPACT_NODE), %lu elements\n", static_cast<unsigned long>(n));
+# else
+	printf("default nodes, %lu elements\n", static_cast<unsigned long>(n));
+# endif
+	printf("node bytes: map<int, int> %lu, set<char> %lu, set<int> %lu, map<int, double> %lu\n",
+		static_cast<unsigned long>(sizeof(ft::Rb_tree_node<ft::pair<const int, int> >)),
+		static_cast<unsigned long>(sizeof(ft::Rb_tree_node<char>)),
+		static_cast<unsigned long>(sizeof(ft::Rb_tree_node<int>)),
+		static_cast<unsigned long>(sizeof(ft::Rb_tree_node<ft::pair<const int, double> >)));
+	keys.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		keys[i] = static_cast<int>(rnd());
+	bench::isolated(std_alloc, n);
+	bench::isolated(pool_alloc, n);
+	return (0);
+}
@@ -0,0 +1,71 @@
+// Millions of tiny vectors (0 to 11 ints, most below 8): heap allocations
+// and time, std::vector vs ft::vector vs ft::small_vector<int, 8>.
+// Global operator new is replaced to count the allocations.
+// c++ -O2 -std=c++98 -I.. small_vector.cpp -o small_vector && ./small_vector [count]
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "vector.hpp"
+#include "small_vector.hpp"
+#include "bench.hpp"
+
+static unsigned long	allocations = 0;
+
+void	*operator new(size_t size) throw(std::bad_alloc)
+{
+	void	*p = malloc(size ? size : 1);
+
+	if (p == 0)
+		throw std::bad_alloc();
+	++allocations;
+	return (p);
+}
+
+void	operator delete(void *p) throw()
+{ free(p); }
+
+template<typename Vector>
+static void	run(const char *name, size_t n)
+{
+	bench::Random	rnd;
+	unsigned long	before = allocations;
+	long			sum = 0;
+	double			t = bench::now();
+	char			label[64];
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		Vector		v;
+		unsigned	len = rnd() % 16;
+
+		len = (len < 12 ? len : len - 8);
+		for (unsigned j = 0; j < len; ++j)
+			v.push_back(static_cast<int>(j));
+		for (size_t j = 0; j < v.size(); ++j)
+			sum += v[j];
+	}
+	bench::report(name, bench::now() - t, static_cast<double>(n));
+	snprintf(label, sizeof(label), "%s allocations", name);
+	printf("%-44s %10lu\n", label, allocations - before);
+	bench::keep(sum);
+}
+
+static void	run_std(size_t n)
+{ run<std::vector<int> >("std::vector", n); }
+
+static void	run_ft(size_t n)
+{ run<ft::vector<int> >("ft::vector", n); }
+
+static void	run_small(size_t n)
+{ run<ft::small_vector<int, 8> >("ft::small_vector<int, 8>", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 5000000);
+
+	printf("%lu vectors\n", static_cast<unsigned long>(n));
+	bench::isolated(run_std, n);
+	bench::isolated(run_ft, n);
+	bench::isolated(run_small, n);
+	return (0);
+}
@@ -0,0 +1,61 @@
+// Building ft::map<int, int> from sorted input (linear bulk build) vs
+// one hinted insert per element, and vs shuffled input.
+// c++ -O2 -std=c++98 -I.. sorted_build.cpp -o sorted_build && ./sorted_build [count]
+#include <algorithm>
+#include <vector>
+#include "map.hpp"
+#include "bench.hpp"
+
+typedef ft::pair<int, int>	pair_type;
+
+static std::vector<pair_type>	sorted;
+static std::vector<pair_type>	shuffled;
+
+static size_t	random_index(size_t n)
+{
+	static bench::Random	rnd;
+
+	return (rnd() % n);
+}
+
+static void	hinted_sorted(size_t n)
+{
+	double				t = bench::now();
+	ft::map<int, int>	m;
+
+	for (size_t i = 0; i < n; ++i)
+		m.insert(m.end(), sorted[i]);
+	bench::report("hinted insert at end(), sorted input", bench::now() - t, n);
+}
+
+static void	range_sorted(size_t n)
+{
+	double				t = bench::now();
+	ft::map<int, int>	m(sorted.begin(), sorted.end());
+
+	bench::report("range constructor, sorted input", bench::now() - t, n);
+}
+
+static void	range_shuffled(size_t n)
+{
+	double				t = bench::now();
+	ft::map<int, int>	m(shuffled.begin(), shuffled.end());
+
+	bench::report("range constructor, shuffled input", bench::now() - t, n);
+}
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 5000000);
+
+	printf("ft::map<int, int>, %lu elements\n", static_cast<unsigned long>(n));
+	sorted.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		sorted[i] = pair_type(static_cast<int>(i * 2), static_cast<int>(i));
+	shuffled = sorted;
+	std::random_shuffle(shuffled.begin(), shuffled.end(), random_index);
+	bench::isolated(hinted_sorted, n);
+	bench::isolated(range_sorted, n);
+	bench::isolated(range_shuffled, n);
+	return (0);
+}
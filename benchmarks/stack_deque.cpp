@@ -0,0 +1,101 @@
+// ft::stack of 4 KiB buffers over ft::vector vs over ft::deque (the default):
+// filling then draining the stack, and a push/pop sawtooth, time and peak RSS.
+// The vector relocates every buffer it holds each time it grows.
+// c++ -O2 -std=c++98 -I.. stack_deque.cpp -o stack_deque && ./stack_deque [count]
+#include <cstring>
+#include "vector.hpp"
+#include "deque.hpp"
+#include "stack.hpp"
+#include "bench.hpp"
+
+struct Buffer
+{
+	int		idx;
+	char	buff[4096];
+};
+
+template<typename Stack>
+static void	fill_drain(const char *name, size_t n)
+{
+	Stack	st;
+	Buffer	b;
+	long	sum = 0;
+	double	t = bench::now();
+	char	label[64];
+
+	std::memset(b.buff, 'x', sizeof(b.buff));
+	for (size_t i = 0; i < n; ++i)
+	{
+		b.idx = static_cast<int>(i);
+		st.push(b);
+	}
+	while (!st.empty())
+	{
+		sum += st.top().idx;
+		st.pop();
+	}
+	bench::report(name, bench::now() - t, static_cast<double>(n));
+	snprintf(label, sizeof(label), "%s peak RSS", name);
+	bench::report_mem(label, bench::peak_rss_kb());
+	bench::keep(sum);
+}
+
+//Grows by 1000 and shrinks by 990 at a time, so the stack keeps crossing
+//its capacity (vector) or its chunk boundaries (deque)
+template<typename Stack>
+static void	sawtooth(const char *name, size_t n)
+{
+	Stack	st;
+	Buffer	b;
+	long	sum = 0;
+	size_t	ops = 0;
+	double	t = bench::now();
+	char	label[64];
+
+	std::memset(b.buff, 'x', sizeof(b.buff));
+	while (st.size() < n)
+	{
+		for (int i = 0; i < 1000; ++i, ++ops)
+		{
+			b.idx = i;
+			st.push(b);
+		}
+		for (int i = 0; i < 990; ++i, ++ops)
+		{
+			sum += st.top().idx;
+			st.pop();
+		}
+	}
+	bench::report(name, bench::now() - t, static_cast<double>(ops));
+	snprintf(label, sizeof(label), "%s peak RSS", name);
+	bench::report_mem(label, bench::peak_rss_kb());
+	bench::keep(sum);
+}
+
+typedef ft::stack<Buffer, ft::vector<Buffer> >	Vector_stack;
+typedef ft::stack<Buffer>						Deque_stack;
+
+static void	fill_vector(size_t n)
+{ fill_drain<Vector_stack>("fill/drain stack<vector>", n); }
+
+static void	fill_deque(size_t n)
+{ fill_drain<Deque_stack>("fill/drain stack<deque>", n); }
+
+static void	sawtooth_vector(size_t n)
+{ sawtooth<Vector_stack>("sawtooth stack<vector>", n); }
+
+static void	sawtooth_deque(size_t n)
+{ sawtooth<Deque_stack>("sawtooth stack<deque>", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 100000);
+
+	printf("%lu buffers of %lu bytes\n", static_cast<unsigned long>(n),
+		static_cast<unsigned long>(sizeof(Buffer)));
+	bench::isolated(fill_vector, n);
+	bench::isolated(fill_deque, n);
+	bench::isolated(sawtooth_vector, n / 10);
+	bench::isolated(sawtooth_deque, n / 10);
+	return (0);
+}
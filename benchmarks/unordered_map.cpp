@@ -0,0 +1,88 @@
+// ft::unordered_map vs ft::map vs std::unordered_map (std::tr1 before
+// C++11): random inserts, lookups (half misses), erase and iteration.
+// c++ -O2 -std=c++98 -I.. unordered_map.cpp -o unordered_map && ./unordered_map [count]
+#include <vector>
+#if __cplusplus >= 201103L
+# include <unordered_map>
+typedef std::unordered_map<int, int>		std_unordered_map;
+#else
+# include <tr1/unordered_map>
+typedef std::tr1::unordered_map<int, int>	std_unordered_map;
+#endif
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "bench.hpp"
+
+typedef ft::pair<int, int>	ft_pair;
+
+enum { lookups = 5000000, scans = 20 };
+
+static std::vector<int>	keys;
+static std::vector<int>	probes;
+
+template<typename Map, typename Pair>
+static void	run(const char *name, size_t n)
+{
+	char	label[128];
+	double	t = bench::now();
+	Map		m;
+
+	for (size_t i = 0; i < n; ++i)
+		m.insert(Pair(keys[i], static_cast<int>(i)));
+	snprintf(label, sizeof(label), "%s insert", name);
+	bench::report(label, bench::now() - t, n);
+	bench::report_mem(name, bench::current_rss_kb());
+
+	size_t	found = 0;
+
+	t = bench::now();
+	for (size_t i = 0; i < lookups; ++i)
+		found += (m.find(probes[i]) != m.end());
+	snprintf(label, sizeof(label), "%s find", name);
+	bench::report(label, bench::now() - t, lookups);
+	bench::keep(found);
+
+	long	sum = 0;
+
+	t = bench::now();
+	for (size_t i = 0; i < scans; ++i)
+		for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+	snprintf(label, sizeof(label), "%s scan", name);
+	bench::report(label, bench::now() - t, static_cast<double>(n) * scans);
+	bench::keep(sum);
+
+	t = bench::now();
+	for (size_t i = 0; i < n; ++i)
+		m.erase(keys[i]);
+	snprintf(label, sizeof(label), "%s erase", name);
+	bench::report(label, bench::now() - t, n);
+}
+
+static void	run_map(size_t n)
+{ run<ft::map<int, int>, ft_pair>("ft::map", n); }
+
+static void	run_unordered_map(size_t n)
+{ run<ft::unordered_map<int, int>, ft_pair>("ft::unordered_map", n); }
+
+static void	run_std_unordered_map(size_t n)
+{ run<std_unordered_map, std::pair<int, int> >("std::unordered_map", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 1000000);
+	bench::Random	rnd;
+
+	printf("<int, int>, %lu elements, %d lookups (half misses), %d scans\n",
+		static_cast<unsigned long>(n), lookups, scans);
+	keys.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		keys[i] = static_cast<int>(rnd() % (n * 4));
+	probes.resize(lookups);
+	for (size_t i = 0; i < lookups; ++i)
+		probes[i] = (i % 2) ? keys[rnd() % n] : static_cast<int>(rnd() % (n * 4));
+	bench::isolated(run_map, n);
+	bench::isolated(run_unordered_map, n);
+	bench::isolated(run_std_unordered_map, n);
+	return (0);
+}
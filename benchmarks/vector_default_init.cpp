@@ -0,0 +1,76 @@
+// Sizing a byte buffer to 1 GiB (argument in MiB) and filling it from a
+// file: resize() zeroes every page before read() overwrites it,
+// resize_default_init() leaves them to read(). The file is sparse, so the
+// reads come from the page cache without disk I/O.
+// c++ -O2 -std=c++98 -I.. vector_default_init.cpp -o vector_default_init && ./vector_default_init [MiB]
+#include <fcntl.h>
+#include <vector>
+#include "vector.hpp"
+#include "bench.hpp"
+
+static char	path[] = "/tmp/vector_default_init_XXXXXX";
+
+static void	fill(char *buf, size_t n)
+{
+	const int	fd = open(path, O_RDONLY);
+	size_t		done = 0;
+	ssize_t		got = 1;
+
+	while (fd >= 0 && done < n && got > 0)
+	{
+		got = read(fd, buf + done, n - done);
+		done += (got > 0 ? got : 0);
+	}
+	if (fd >= 0)
+		close(fd);
+}
+
+template<typename Vector>
+static void	resize(Vector &v, size_t n)
+{ v.resize(n); }
+
+static void	resize_default_init(ft::vector<char> &v, size_t n)
+{ v.resize_default_init(n); }
+
+template<typename Vector>
+static void	run_resize(const char *name, size_t n, void (*size)(Vector &, size_t))
+{
+	Vector	v;
+	double	t = bench::now();
+	double	sized;
+	char	label[64];
+
+	size(v, n);
+	sized = bench::now();
+	fill(&v[0], n);
+	snprintf(label, sizeof(label), "%s", name);
+	bench::report(label, sized - t, static_cast<double>(n) / (1 << 20));
+	snprintf(label, sizeof(label), "%s + read", name);
+	bench::report(label, bench::now() - t, static_cast<double>(n) / (1 << 20));
+	bench::keep(v[n / 2]);
+}
+
+static void	run_std(size_t n)
+{ run_resize<std::vector<char> >("std::vector resize", n, resize); }
+
+static void	run_ft(size_t n)
+{ run_resize<ft::vector<char> >("ft::vector resize", n, resize); }
+
+static void	run_ft_default_init(size_t n)
+{ run_resize<ft::vector<char> >("ft::vector resize_default_init", n, resize_default_init); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 1024) << 20;
+	const int		fd = mkstemp(path);
+
+	if (fd < 0 || ftruncate(fd, n) != 0)
+		return (1);
+	close(fd);
+	printf("%lu MiB, ops are MiB\n", static_cast<unsigned long>(n >> 20));
+	bench::isolated(run_std, n);
+	bench::isolated(run_ft, n);
+	bench::isolated(run_ft_default_init, n);
+	unlink(path);
+	return (0);
+}
@@ -0,0 +1,58 @@
+// Growing an ft::vector of 4 KiB buffers to a few GiB with push_back:
+// std::allocator copies every element at each doubling, ft::malloc_allocator
+// and ft::mmap_allocator let the block grow in place (realloc, mremap).
+// c++ -O2 -std=c++98 -I.. vector_growth.cpp -o vector_growth && ./vector_growth [MiB]
+#include <memory>
+#include "vector.hpp"
+#include "ft_realloc_allocator.hpp"
+#include "bench.hpp"
+
+struct Buffer
+{
+	int		idx;
+	char	buff[4096];
+};
+
+template<typename Alloc>
+static void	run(const char *name, size_t mib)
+{
+	const size_t				n = mib * 1024 * 1024 / sizeof(Buffer);
+	ft::vector<Buffer, Alloc>	v;
+	Buffer						b;
+	double						t;
+	char						label[64];
+
+	b.buff[0] = 0;
+	t = bench::now();
+	for (size_t i = 0; i < n; ++i)
+	{
+		b.idx = static_cast<int>(i);
+		v.push_back(b);
+	}
+	snprintf(label, sizeof(label), "%s push_back", name);
+	bench::report(label, bench::now() - t, static_cast<double>(n));
+	snprintf(label, sizeof(label), "%s peak RSS", name);
+	bench::report_mem(label, bench::peak_rss_kb());
+	bench::keep(v.back());
+}
+
+static void	run_std(size_t mib)
+{ run<std::allocator<Buffer> >("std::allocator", mib); }
+
+static void	run_malloc(size_t mib)
+{ run<ft::malloc_allocator<Buffer> >("ft::malloc_allocator", mib); }
+
+static void	run_mmap(size_t mib)
+{ run<ft::mmap_allocator<Buffer> >("ft::mmap_allocator", mib); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	mib = bench::arg_size(argc, argv, 4096);
+
+	printf("%lu MiB of %lu byte buffers\n", static_cast<unsigned long>(mib),
+		static_cast<unsigned long>(sizeof(Buffer)));
+	bench::isolated(run_std, mib);
+	bench::isolated(run_malloc, mib);
+	bench::isolated(run_mmap, mib);
+	return (0);
+}
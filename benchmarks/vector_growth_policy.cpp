@@ -0,0 +1,64 @@
+// push_back throughput vs memory overhead of the ft::vector growth policies.
+// Vectors of n/2 to n ints are built one element at a time; slack is the
+// unused capacity at the end, relative to the size. growth_exact reallocates
+// on every push_back, it only runs on n / 1000 elements.
+// c++ -O2 -std=c++98 -I.. vector_growth_policy.cpp -o vector_growth_policy && ./vector_growth_policy [count]
+#include "vector.hpp"
+#include "bench.hpp"
+
+enum { rounds = 8 };
+
+template<typename Growth>
+static void	run(const char *name, size_t n)
+{
+	double	slack = 0;
+	double	total = 0;
+	double	t = bench::now();
+	char	label[64];
+
+	for (size_t r = 0; r < rounds; ++r)
+	{
+		ft::vector<int, std::allocator<int>, Growth>	v;
+		const size_t									len = n / 2 + n / 2 * r / rounds + r * 7919;
+
+		for (size_t i = 0; i < len; ++i)
+			v.push_back(static_cast<int>(i));
+		slack += static_cast<double>(v.capacity() - v.size()) / v.size();
+		total += len;
+		bench::keep(v.back());
+	}
+	bench::report(name, bench::now() - t, total);
+	snprintf(label, sizeof(label), "%s slack", name);
+	printf("%-44s %10.1f %%\n", label, slack / rounds * 100);
+	snprintf(label, sizeof(label), "%s peak RSS", name);
+	bench::report_mem(label, bench::peak_rss_kb());
+}
+
+static void	run_double(size_t n)
+{ run<ft::growth_double>("growth_double", n); }
+
+static void	run_1_5(size_t n)
+{ run<ft::growth_1_5>("growth_1_5", n); }
+
+static void	run_page(size_t n)
+{ run<ft::growth_page>("growth_page", n); }
+
+static void	run_size_class(size_t n)
+{ run<ft::growth_size_class>("growth_size_class", n); }
+
+static void	run_exact(size_t n)
+{ run<ft::growth_exact>("growth_exact (n / 1000)", n / 1000); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 20000000);
+
+	printf("%d vectors of %lu to %lu ints\n", rounds, static_cast<unsigned long>(n / 2),
+		static_cast<unsigned long>(n));
+	bench::isolated(run_double, n);
+	bench::isolated(run_1_5, n);
+	bench::isolated(run_page, n);
+	bench::isolated(run_size_class, n);
+	bench::isolated(run_exact, n);
+	return (0);
+}
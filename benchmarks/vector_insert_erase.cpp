@@ -0,0 +1,66 @@
+// Mid-vector insert and erase on 1M ints: every operation shifts the tail,
+// which ft::vector does with memmove for trivially copyable elements.
+// c++ -O2 -std=c++98 -I.. vector_insert_erase.cpp -o vector_insert_erase && ./vector_insert_erase [count]
+#include <vector>
+#include "vector.hpp"
+#include "bench.hpp"
+
+enum { ops = 2000, chunk = 16 };
+
+template<typename Vector>
+static void	run(const char *name, size_t n)
+{
+	Vector			v;
+	bench::Random	rnd;
+	int				block[chunk] = {0};
+	double			t;
+	char			label[64];
+
+	for (size_t i = 0; i < n; ++i)
+		v.push_back(static_cast<int>(i));
+
+	t = bench::now();
+	for (size_t i = 0; i < ops; ++i)
+		v.insert(v.begin() + rnd() % v.size(), static_cast<int>(i));
+	snprintf(label, sizeof(label), "%s insert", name);
+	bench::report(label, bench::now() - t, ops);
+
+	t = bench::now();
+	for (size_t i = 0; i < ops; ++i)
+		v.erase(v.begin() + rnd() % v.size());
+	snprintf(label, sizeof(label), "%s erase", name);
+	bench::report(label, bench::now() - t, ops);
+
+	t = bench::now();
+	for (size_t i = 0; i < ops; ++i)
+		v.insert(v.begin() + rnd() % v.size(), block, block + chunk);
+	snprintf(label, sizeof(label), "%s insert 16", name);
+	bench::report(label, bench::now() - t, ops);
+
+	t = bench::now();
+	for (size_t i = 0; i < ops; ++i)
+	{
+		typename Vector::iterator	it = v.begin() + rnd() % (v.size() - chunk);
+
+		v.erase(it, it + chunk);
+	}
+	snprintf(label, sizeof(label), "%s erase 16", name);
+	bench::report(label, bench::now() - t, ops);
+	bench::keep(v.back());
+}
+
+static void	run_std(size_t n)
+{ run<std::vector<int> >("std::vector", n); }
+
+static void	run_ft(size_t n)
+{ run<ft::vector<int> >("ft::vector", n); }
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 1000000);
+
+	printf("%lu ints, %d operations per row\n", static_cast<unsigned long>(n), ops);
+	bench::isolated(run_std, n);
+	bench::isolated(run_ft, n);
+	return (0);
+}
@@ -0,0 +1,89 @@
+// ft::vector appends: push_back one element at a time and append(first, last)
+// of the whole range, for int, std::string and the 4 KiB Buffer of main.cpp,
+// with std::vector push_back as reference.
+// c++ -O2 -std=c++98 -I.. vector_push_back.cpp -o vector_push_back && ./vector_push_back [count]
+#include <string>
+#include <vector>
+#include "vector.hpp"
+#include "bench.hpp"
+
+struct Buffer
+{
+	int		idx;
+	char	buff[4096];
+};
+
+enum { rounds = 10 };
+
+static std::vector<int>			ints;
+static std::vector<std::string>	strings;
+static std::vector<Buffer>		buffers;
+
+template<typename Vector, typename T>
+static void	push_back(const char *name, const std::vector<T> &src)
+{
+	double	t = bench::now();
+
+	for (size_t r = 0; r < rounds; ++r)
+	{
+		Vector v;
+
+		for (size_t i = 0; i < src.size(); ++i)
+			v.push_back(src[i]);
+		bench::keep(v.size());
+	}
+	bench::report(name, bench::now() - t, static_cast<double>(src.size()) * rounds);
+}
+
+template<typename T>
+static void	append(const char *name, const std::vector<T> &src)
+{
+	double	t = bench::now();
+
+	for (size_t r = 0; r < rounds; ++r)
+	{
+		ft::vector<T> v;
+
+		v.append(src.begin(), src.end());
+		bench::keep(v.size());
+	}
+	bench::report(name, bench::now() - t, static_cast<double>(src.size()) * rounds);
+}
+
+static void	run_int(size_t)
+{
+	push_back<std::vector<int> >("int std::vector push_back", ints);
+	push_back<ft::vector<int> >("int ft::vector push_back", ints);
+	append("int ft::vector append", ints);
+}
+
+static void	run_string(size_t)
+{
+	push_back<std::vector<std::string> >("string std::vector push_back", strings);
+	push_back<ft::vector<std::string> >("string ft::vector push_back", strings);
+	append("string ft::vector append", strings);
+}
+
+static void	run_buffer(size_t)
+{
+	push_back<std::vector<Buffer> >("Buffer std::vector push_back", buffers);
+	push_back<ft::vector<Buffer> >("Buffer ft::vector push_back", buffers);
+	append("Buffer ft::vector append", buffers);
+}
+
+int	main(int argc, char **argv)
+{
+	const size_t	n = bench::arg_size(argc, argv, 10000000);
+
+	printf("%lu ints, %lu strings, %lu Buffers, %d rounds\n", static_cast<unsigned long>(n),
+		static_cast<unsigned long>(n / 10), static_cast<unsigned long>(n / 1000), rounds);
+	ints.resize(n);
+	for (size_t i = 0; i < n; ++i)
+		ints[i] = static_cast<int>(i);
+	strings.resize(n / 10, std::string("a string longer than the small buffer"));
+	buffers.resize(n / 1000);
+	bench::isolated(run_int, n);
+	bench::isolated(run_string, n);
+	bench::isolated(run_buffer, n);
+	return (0);
+}
@@ -0,0 +1,229 @@
+#ifndef BTREE_MAP_HPP
+# define BTREE_MAP_HPP
+
+# include <functional>
+# include <memory>
+# include "ft_btree.hpp"
+# include "map.hpp"
+
+namespace ft
+{
+	template
+	<
+		typename Key,
+		typename Value,
+		typename Compare = std::less<Key>,
+		typename Alloc = std::allocator<ft::pair <const Key, Value> >
+	>
+	//map interface over a B+tree (see ft_btree.hpp): faster lookups and scans,
+	//but insert and erase invalidate iterators
+	class btree_map
+	{
+		public:
+			typedef Key								key_type;
+			typedef	Value							mapped_type;
+			typedef ft::pair<const Key, Value>		value_type;
+			typedef Compare							key_compare;
+			typedef Alloc							allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef Btree<key_type, value_type, ft::Select1st<value_type>, key_compare, allocator_type>	_Btree;
+			_Btree _btree;
+
+		public:
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				friend class btree_map<Key, Value, Compare, Alloc>;
+
+				protected:
+					Compare	comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					bool	operator()(const value_type &x, const value_type &y) const
+					{ return comp(x.first, y.first); }
+			};
+
+			typedef typename _Btree::iterator								iterator;
+			typedef typename _Btree::const_iterator						const_iterator;
+			typedef typename _Btree::reverse_iterator						reverse_iterator;
+			typedef typename _Btree::const_reverse_iterator				const_reverse_iterator;
+			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+			typedef typename _Btree::size_type							size_type;
+
+			//CONSTRUCTORS, OPERATOR=
+
+			explicit btree_map(const key_compare &comp = key_compare(),
+				const allocator_type &alloc = allocator_type())
+				: _btree(comp, alloc) {}
+
+			btree_map(const btree_map &src) : _btree(src._btree) {}
+
+			template<typename Iterator>
+			btree_map(Iterator first, Iterator last,
+				const key_compare &comp = key_compare(),
+				const allocator_type &alloc = allocator_type())
+				: _btree(comp, alloc)
+			{ _btree.insert_unique(first, last); }
+
+			btree_map&	operator=(const btree_map &src)
+			{
+				_btree = src._btree;
+				return (*this);
+			}
+			//ITERATORS
+			iterator begin()
+			{ return _btree.begin(); }
+
+			const_iterator begin() const
+			{ return _btree.begin(); }
+
+			iterator end()
+			{ return _btree.end(); }
+
+			const_iterator end() const
+			{ return _btree.end(); }
+
+			reverse_iterator rbegin()
+			{ return _btree.rbegin(); }
+
+			const_reverse_iterator rbegin() const
+			{ return _btree.rbegin(); }
+
+			reverse_iterator rend()
+			{ return _btree.rend(); }
+
+			const_reverse_iterator rend()  const
+			{ return _btree.rend(); }
+
+			//CAPACITY
+			bool empty() const
+			{ return _btree.empty(); }
+
+			size_type	max_size() const
+			{ return _btree.max_size(); }
+
+			size_type	size() const
+			{ return _btree.size(); }
+
+			//ELEMENT ACCESS
+			mapped_type&	operator[](const key_type &k)
+			{
+				iterator it = lower_bound(k);
+				if (it == end() || key_comp()(k, (*it).first))
+					it = insert(it, value_type(k, mapped_type()));
+				return (*it).second;
+			}
+			//MODIFIERS
+			ft::pair<iterator,bool>	insert(const value_type &val)
+			{ return _btree.insert_unique(val); }
+
+			iterator	insert(iterator position, const value_type &val)
+			{ return _btree.insert_unique(position, val); }
+
+			template<typename Iterator>
+			void	insert(Iterator first, Iterator last)
+			{ _btree.insert_unique(first, last); }
+
+			void	erase(iterator position)
+			{ _btree.erase(position); }
+
+			size_type	erase(const key_type &k)
+			{ return _btree.erase(k); }
+
+			void	erase(iterator first, iterator last)
+			{ _btree.erase(first, last); }
+
+			void	swap(btree_map &s)
+			{ _btree.swap(s._btree); }
+
+			void clear()
+			{ _btree.clear(); }
+
+			//OBSERVERS
+			key_compare	key_comp() const
+			{ return _btree.key_comp(); }
+
+			value_compare	value_comp() const
+			{ return value_compare(_btree.key_comp()); }
+
+			//OPERATIONS
+			iterator find (const key_type &k)
+			{ return _btree.find(k); }
+
+			const_iterator find (const key_type &k) const
+			{ return _btree.find(k); }
+
+			size_type	count(const key_type &k) const
+			{ return (_btree.find(k) == _btree.end() ? 0 : 1); }
+
+			iterator lower_bound(const key_type &k)
+			{ return _btree.lower_bound(k); }
+
+			const_iterator lower_bound(const key_type &k) const
+			{ return _btree.lower_bound(k); }
+
+			iterator upper_bound(const key_type &k)
+			{ return _btree.upper_bound(k); }
+
+			const_iterator upper_bound(const key_type &k) const
+			{ return _btree.upper_bound(k); }
+
+			ft::pair<iterator, iterator>	equal_range(const key_type &k)
+			{ return _btree.equal_range(k); }
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+			{ return _btree.equal_range(k); }
+
+			//ALLOCATOR
+			allocator_type	get_allocator() const
+			{ return _btree.get_allocator(); }
+
+			//Friend prototype to have access to private _btree outside
+			template<typename K, typename T, typename C, typename A>
+			friend bool	operator==(const btree_map<K, T, C, A>&, const btree_map<K, T, C, A>&);
+
+			template<typename K, typename T, typename C, typename A>
+			friend bool	operator<(const btree_map<K, T, C, A>&, const btree_map<K, T, C, A>&);
+	};
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator==(const btree_map<Key, Tp, Compare, Alloc> &x,
+		const btree_map<Key, Tp, Compare, Alloc> &y)
+	{ return (x._btree == y._btree); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator<(const btree_map<Key, Tp, Compare, Alloc> &x,
+		const btree_map<Key, Tp, Compare, Alloc> &y)
+	{ return (x._btree < y._btree); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator!=(const btree_map<Key, Tp, Compare, Alloc> &x,
+		const btree_map<Key, Tp, Compare, Alloc> &y)
+	{ return !(x == y); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator>(const btree_map<Key, Tp, Compare, Alloc> &x,
+		const btree_map<Key, Tp, Compare, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator<=(const btree_map<Key, Tp, Compare, Alloc> &x,
+		const btree_map<Key, Tp, Compare, Alloc> &y)
+	{ return !(y < x); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator>=(const btree_map<Key, Tp, Compare, Alloc> &x,
+		const btree_map<Key, Tp, Compare, Alloc> &y)
+	{ return !(x < y); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline void swap(btree_map<Key, Tp, Compare, Alloc> &x, btree_map<Key, Tp, Compare, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef BTREE_SET_HPP
+# define BTREE_SET_HPP
+
+# include <functional>
+# include <memory>
+# include "ft_iterator.hpp"
+# include "ft_btree.hpp"
+# include "ft_utilities.hpp"
+# include "set.hpp"
+
+namespace	ft
+{
+	template
+	<
+		typename Key,
+		typename Compare = std::less<Key>,
+		typename Alloc = std::allocator<Key>
+	>
+	//set interface over a B+tree (see ft_btree.hpp): faster lookups and scans,
+	//but insert and erase invalidate iterators
+	class btree_set
+	{
+		public:
+			typedef Key		key_type;
+			typedef Key		value_type;
+			typedef Compare	key_compare;
+			typedef	Compare	value_compare;
+			typedef Alloc	allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef Btree<key_type, value_type, ft::Identity<value_type>, key_compare, allocator_type>	_Btree;
+			_Btree _btree;
+		public:
+			typedef typename _Btree::const_iterator						iterator;
+			typedef typename _Btree::const_iterator						const_iterator;
+			typedef typename _Btree::const_reverse_iterator				reverse_iterator;
+			typedef typename _Btree::const_reverse_iterator				const_reverse_iterator;
+			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+			typedef typename _Btree::size_type							size_type;
+		//Constructor and operator=
+		explicit	btree_set(const Compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type())
+			: _btree(comp, alloc) {}
+
+		template <typename It>
+		btree_set(It first, It last, const Compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type())
+			: _btree(comp, alloc)
+		{ _btree.insert_unique(first, last); }
+
+		btree_set(const btree_set &x) : _btree(x._btree) {}
+
+		btree_set&	operator=(const btree_set &src)
+		{
+			_btree = src._btree;
+			return *this;
+		}
+		//Accessors
+		key_compare	key_comp() const
+		{ return _btree.key_comp(); }
+
+		value_compare	value_comp() const
+		{ return _btree.key_comp(); }
+
+		//Iterators
+		iterator	begin()
+		{ return _btree.begin(); }
+
+		const_iterator	begin() const
+		{ return _btree.begin(); }
+
+		iterator	end()
+		{ return _btree.end(); }
+
+		const_iterator	end() const
+		{ return _btree.end(); }
+
+		reverse_iterator	rbegin()
+		{ return _btree.rbegin(); }
+
+		const_reverse_iterator	rbegin() const
+		{ return _btree.rbegin(); }
+
+		reverse_iterator	rend()
+		{ return _btree.rend(); }
+
+		const_reverse_iterator	rend() const
+		{ return _btree.rend(); }
+		//Capacity
+		bool	empty() const
+		{ return _btree.empty(); }
+
+		size_type	size() const
+		{ return _btree.size(); }
+
+		size_type	max_size() const
+		{ return _btree.max_size(); }
+		//Modifiers
+		void	swap(btree_set &x)
+		{ _btree.swap(x._btree); }
+
+		ft::pair<iterator, bool>	insert(const value_type &val)
+		{ return _btree.insert_unique(val); }
+
+		iterator	insert(iterator position, const value_type &val)
+		{ return _btree.insert_unique(position, val); }
+
+		template<typename It>
+		void	insert(It first, It last)
+		{ _btree.insert_unique(first, last); }
+
+		void	erase(iterator position)
+		{ _btree.erase(position); }
+
+		size_type	erase(const value_type &val)
+		{ return _btree.erase(val); }
+
+		void	erase(iterator first, iterator last)
+		{ return _btree.erase(first, last); }
+
+		void	clear()
+		{ _btree.clear(); }
+
+		//Operations
+		iterator	find(const value_type &val)
+		{ return _btree.find(val); }
+
+		const_iterator	find(const value_type &val) const
+		{ return _btree.find(val); }
+
+		size_type	count(const value_type &val) const
+		{ return (_btree.find(val) == _btree.end() ? 0 : 1); }
+
+		iterator	lower_bound(const value_type &val)
+		{ return _btree.lower_bound(val); }
+
+		const_iterator	lower_bound(const value_type &val) const
+		{ return _btree.lower_bound(val); }
+
+		iterator	upper_bound(const value_type &val)
+		{ return _btree.upper_bound(val); }
+
+		const_iterator	upper_bound(const value_type &val) const
+		{ return _btree.upper_bound(val); }
+
+		ft::pair<iterator, iterator>	equal_range(const value_type &val)
+		{ return _btree.equal_range(val); }
+
+		ft::pair<const_iterator, const_iterator>	equal_range(const value_type &val) const
+		{ return _btree.equal_range(val); }
+
+		//Allocator
+		allocator_type	get_allocator() const
+		{ return _btree.get_allocator(); }
+		//Friend prototype to have access to private _btree outside
+		template<typename K, typename C, typename A>
+		friend bool	operator==(const btree_set<K, C, A>&, const btree_set<K, C, A>&);
+
+		template<typename K, typename C, typename A>
+		friend bool	operator<(const btree_set<K, C, A>&, const btree_set<K, C, A>&);
+	};
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator==(const btree_set<Key, Compare, Alloc> &x,
+		const btree_set<Key, Compare, Alloc> &y)
+	{ return (x._btree == y._btree); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator<(const btree_set<Key, Compare, Alloc> &x,
+		const btree_set<Key, Compare, Alloc> &y)
+	{ return (x._btree < y._btree); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator!=(const btree_set<Key, Compare, Alloc> &x,
+		const btree_set<Key, Compare, Alloc> &y)
+	{ return !(x == y); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator>(const btree_set<Key, Compare, Alloc> &x,
+		const btree_set<Key, Compare, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator<=(const btree_set<Key, Compare, Alloc> &x,
+		const btree_set<Key, Compare, Alloc> &y)
+	{ return !(y < x); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator>=(const btree_set<Key, Compare, Alloc> &x,
+		const btree_set<Key, Compare, Alloc> &y)
+	{ return !(x < y); }
+
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline void swap(btree_set<Key, Compare, Alloc> &x, btree_set<Key, Compare, Alloc> &y)
+	{ x.swap(y); }
+}
+#endif
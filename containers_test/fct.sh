@@ -146,7 +146,7 @@ do_test () {
 
 function main () {
 	pheader
-	containers=(vector map stack set)
+	containers=(vector list map stack queue set deque multimap multiset small_vector flat_map flat_set btree_map btree_set unordered_map unordered_set priority_queue)
 	# containers=(vector list map stack queue deque multimap set multiset)
 	if [ $# -ne 0 ]; then
 		containers=($@);
@@ -0,0 +1,47 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 float
+#define T2 foo<int>
+typedef _pair<const T1, T2> T3;
+
+int		main(void)
+{
+	std::list<T3> lst;
+	unsigned int lst_size = 5;
+	for (unsigned int i = 0; i < lst_size; ++i)
+		lst.push_back(T3(2.5 + i, i + 1));
+
+	TESTED_MAP<T1, T2> mp(lst.begin(), lst.end());
+	TESTED_MAP<T1, T2>::iterator it(mp.begin());
+	TESTED_MAP<T1, T2>::const_iterator ite(mp.begin());
+	printSize(mp);
+
+	printPair(++ite);
+	printPair(ite++);
+	printPair(ite++);
+	printPair(++ite);
+
+	it->second.m();
+	ite->second.m();
+
+	printPair(++it);
+	printPair(it++);
+	printPair(it++);
+	printPair(++it);
+
+	printPair(--ite);
+	printPair(ite--);
+	printPair(--ite);
+	printPair(ite--);
+
+	(*it).second.m();
+	(*ite).second.m();
+
+	printPair(--it);
+	printPair(it--);
+	printPair(it--);
+	printPair(--it);
+
+	return (0);
+}
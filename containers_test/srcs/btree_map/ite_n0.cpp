@@ -0,0 +1,14 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+
+int		main(void)
+{
+	TESTED_MAP<T1, T2> mp;
+	mp[1] = 2;
+
+	TESTED_MAP<T1, T2>::const_iterator ite = mp.begin();
+	*ite = 42; // < -- error
+	return (0);
+}
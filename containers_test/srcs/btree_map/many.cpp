@@ -0,0 +1,66 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef _pair<const T1, T2> T3;
+
+typedef TESTED_MAP<T1, T2>	t_map;
+
+//Deterministic keys, enough of them to split and merge inner nodes
+static unsigned	g_seed = 42;
+
+static int	next_key(void)
+{
+	g_seed = g_seed * 1103515245 + 12345;
+	return (static_cast<int>((g_seed >> 8) % 20000));
+}
+
+static void	printSample(t_map const &mp)
+{
+	t_map::const_iterator	it = mp.begin();
+	long					sum = 0;
+
+	for (size_t i = 0; it != mp.end(); ++it, ++i)
+	{
+		sum += it->first * 3 + it->second;
+		if (i % 500 == 0)
+			printPair(it);
+	}
+	std::cout << "size: " << mp.size() << " | sum: " << sum << std::endl;
+}
+
+int		main(void)
+{
+	t_map	mp;
+
+	for (int i = 0; i < 8000; ++i)
+		mp.insert(T3(next_key(), i));
+	printSample(mp);
+
+	for (int i = 0; i < 4000; ++i)
+		mp.erase(next_key());
+	printSample(mp);
+
+	t_map::iterator	first = mp.lower_bound(5000);
+	t_map::iterator	last = mp.upper_bound(9000);
+
+	mp.erase(first, last);
+	printSample(mp);
+	for (int k = 4000; k < 12000; k += 999)
+	{
+		t_map::const_iterator	lo = mp.lower_bound(k);
+		t_map::const_iterator	hi = mp.upper_bound(k);
+
+		std::cout << k << ": " << (lo == mp.end() ? -1 : lo->first)
+			<< " " << (hi == mp.end() ? -1 : hi->first) << " " << mp.count(k) << std::endl;
+	}
+
+	t_map	cpy(mp.rbegin(), mp.rend());
+
+	std::cout << "copy equal: " << (cpy == mp) << std::endl;
+	while (!mp.empty())
+		mp.erase(mp.begin());
+	printSample(mp);
+	printSample(cpy);
+	return (0);
+}
@@ -0,0 +1,39 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+
+int		main(void)
+{
+	std::list<T1> lst;
+	unsigned int lst_size = 7;
+	for (unsigned int i = 0; i < lst_size; ++i)
+		lst.push_back(lst_size - i);
+
+	TESTED_SET<T1> st(lst.begin(), lst.end());
+	TESTED_SET<T1>::iterator it = st.begin(), ite = st.end();
+
+	TESTED_SET<T1> st_range(it, --(--ite));
+	for (int i = 0; i < 5; ++i)
+		st.insert(i * 5);
+
+	it = st.begin(); ite = --(--st.end());
+	TESTED_SET<T1> st_copy(st);
+	for (int i = 0; i < 7; ++i)
+		st.insert(i * 7);
+
+	std::cout << "\t-- PART ONE --" << std::endl;
+	printSize(st);
+	printSize(st_range);
+	printSize(st_copy);
+
+	st = st_copy;
+	st_copy = st_range;
+	st_range.clear();
+
+	std::cout << "\t-- PART TWO --" << std::endl;
+	printSize(st);
+	printSize(st_range);
+	printSize(st_copy);
+	return (0);
+}
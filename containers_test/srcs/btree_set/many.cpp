@@ -0,0 +1,61 @@
+#include "common.hpp"
+
+#define T1 int
+
+typedef TESTED_SET<T1>	t_set;
+
+//Deterministic keys, enough of them to split and merge inner nodes
+static unsigned	g_seed = 42;
+
+static int	next_key(void)
+{
+	g_seed = g_seed * 1103515245 + 12345;
+	return (static_cast<int>((g_seed >> 8) % 20000));
+}
+
+static void	printSample(t_set const &st)
+{
+	t_set::const_iterator	it = st.begin();
+	long					sum = 0;
+
+	for (size_t i = 0; it != st.end(); ++it, ++i)
+	{
+		sum += *it;
+		if (i % 500 == 0)
+			printPair(it);
+	}
+	std::cout << "size: " << st.size() << " | sum: " << sum << std::endl;
+}
+
+int		main(void)
+{
+	t_set	st;
+
+	for (int i = 0; i < 8000; ++i)
+		st.insert(next_key());
+	printSample(st);
+
+	for (int i = 0; i < 4000; ++i)
+		st.erase(next_key());
+	printSample(st);
+
+	st.erase(st.lower_bound(5000), st.upper_bound(9000));
+	printSample(st);
+	for (int k = 4000; k < 12000; k += 999)
+	{
+		t_set::const_iterator	lo = st.lower_bound(k);
+		t_set::const_iterator	hi = st.upper_bound(k);
+
+		std::cout << k << ": " << (lo == st.end() ? -1 : *lo)
+			<< " " << (hi == st.end() ? -1 : *hi) << " " << st.count(k) << std::endl;
+	}
+
+	t_set	cpy(st.rbegin(), st.rend());
+
+	std::cout << "copy equal: " << (cpy == st) << std::endl;
+	while (!st.empty())
+		st.erase(--st.end());
+	printSample(st);
+	printSample(cpy);
+	return (0);
+}
@@ -0,0 +1,58 @@
+#include "../base.hpp"
+#if !defined(USING_STD)
+# include "flat_map.hpp"
+# define TESTED_MAP ft::flat_map
+#else
+# include <map>
+# define TESTED_MAP std::map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+//*it is a proxy on ft::flat_map and a pair on std::map, both have first
+//and second
+template <typename T>
+std::string	printValue(const T &value, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << value.first << " | value: " << value.second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+//max_size is left out: it depends on the two vectors of ft::flat_map
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content)
+	{
+		typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printValue(*it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+template <typename T1, typename T2>
+void	printReverse(TESTED_MAP<T1, T2> &mp)
+{
+	typename TESTED_MAP<T1, T2>::iterator it = mp.end(), ite = mp.begin();
+
+	std::cout << "printReverse:" << std::endl;
+	while (it != ite) {
+		it--;
+		std::cout << "-> " << printPair(it, false) << std::endl;
+	}
+	std::cout << "_______________________________________________" << std::endl;
+}
@@ -0,0 +1,13 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+
+int		main(void)
+{
+	TESTED_MAP<T1, T2> const mp;
+	TESTED_MAP<T1, T2>::iterator it = mp.begin(); // <-- error expected
+
+	(void)it;
+	return (0);
+}
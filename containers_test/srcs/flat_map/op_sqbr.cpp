@@ -0,0 +1,23 @@
+#include "common.hpp"
+
+#define T1 char
+#define T2 foo<std::string>
+
+int		main(void)
+{
+	TESTED_MAP<T1, T2> mp;
+
+	mp['a'] = "an element";
+	mp['b'] = "another element";
+	//Inserting 'c' moves the mapped values: copy 'b' out first
+	T2 b = mp['b'];
+	mp['c'] = b;
+	mp['b'] = "old element";
+
+	printSize(mp);
+
+	std::cout << "insert a new element via operator[]: " << mp['d'] << std::endl;
+
+	printSize(mp);
+	return (0);
+}
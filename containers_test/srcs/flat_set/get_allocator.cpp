@@ -0,0 +1,92 @@
+#include "common.hpp"
+#include <memory>
+
+#define T1 std::string
+
+//An allocator that cannot be default constructed: every block of the set,
+//including the ones range insertion stages its batch in, must come from
+//the instance it was given
+struct Arena
+{
+	const char	*name;
+	long		allocated;
+};
+
+template <typename T>
+class arena_allocator : public std::allocator<T>
+{
+	public:
+		typedef typename std::allocator<T>::pointer		pointer;
+		typedef typename std::allocator<T>::size_type	size_type;
+
+		template <typename U>
+		struct rebind
+		{ typedef arena_allocator<U> other; };
+
+		Arena	*arena;
+
+		explicit arena_allocator(Arena *a) : arena(a) {}
+
+		template <typename U>
+		arena_allocator(const arena_allocator<U> &src) : std::allocator<T>(), arena(src.arena) {}
+
+		pointer	allocate(size_type n, const void * = 0)
+		{
+			arena->allocated += n;
+			return (std::allocator<T>::allocate(n));
+		}
+
+		void	deallocate(pointer p, size_type n)
+		{
+			arena->allocated -= n;
+			std::allocator<T>::deallocate(p, n);
+		}
+};
+
+template <typename T, typename U>
+bool	operator==(const arena_allocator<T> &x, const arena_allocator<U> &y)
+{ return (x.arena == y.arena); }
+
+template <typename T, typename U>
+bool	operator!=(const arena_allocator<T> &x, const arena_allocator<U> &y)
+{ return (x.arena != y.arena); }
+
+typedef TESTED_SET<T1, std::less<T1>, arena_allocator<T1> > arena_set;
+
+static void	printArena(const Arena &a)
+{
+	std::cout << a.name << " in use: " << (a.allocated != 0) << std::endl;
+}
+
+int		main(void)
+{
+	Arena			first = {"first", 0};
+	Arena			second = {"second", 0};
+	std::less<T1>	comp;
+	TESTED_SET<T1>	src;
+
+	for (int i = 0; i < 30; ++i)
+		src.insert(std::string(i % 5 + 1, 'a' + (i * 7) % 26));
+	{
+		arena_set	st1(src.begin(), src.end(), comp, arena_allocator<T1>(&first));
+		arena_set	st2(comp, arena_allocator<T1>(&second));
+
+		st2.insert(src.begin(), src.end());
+		st2.insert(st1.begin(), st1.end());
+		printSize(st1);
+		printSize(st2);
+		printArena(first);
+		printArena(second);
+		std::cout << "owned by " << st1.get_allocator().arena->name << std::endl;
+		std::cout << "owned by " << st2.get_allocator().arena->name << std::endl;
+
+		arena_set	cpy(st2);
+
+		std::cout << "copy owned by " << cpy.get_allocator().arena->name << std::endl;
+		cpy.clear();
+		std::cout << "equal: " << (st1 == st2) << std::endl;
+	}
+	printArena(first);
+	printArena(second);
+	return (0);
+}
@@ -0,0 +1,12 @@
+#include "common.hpp"
+
+#define T1 int
+
+int		main(void)
+{
+	TESTED_SET<T1> const st;
+	TESTED_SET<T1>::iterator it = st.begin(); // <-- no error, actually ! set allows for const_iterator => iterator conversion
+
+	(void)it;
+	return (0);
+}
@@ -5,14 +5,14 @@
 # include <list>
 #endif /* !defined(STD) */
 
-template <typename T>
-void	printSize(TESTED_NAMESPACE::list<T> const &lst, bool print_content = 1)
+template <typename T_LIST>
+void	printSize(T_LIST const &lst, bool print_content = 1)
 {
 	std::cout << "size: " << lst.size() << std::endl;
 	std::cout << "max_size: " << lst.max_size() << std::endl;
 	if (print_content)
 	{
-		typename TESTED_NAMESPACE::list<T>::const_iterator it = lst.begin(), ite = lst.end();
+		typename T_LIST::const_iterator it = lst.begin(), ite = lst.end();
 		std::cout << std::endl << "Content is:" << std::endl;
 		for (; it != ite; ++it)
 			std::cout << "- " << *it << std::endl;
@@ -0,0 +1,65 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_pool_allocator.hpp"
+# define TESTED_ALLOC ft::pool_allocator
+#else
+# define TESTED_ALLOC std::allocator
+#endif
+
+#define TESTED_TYPE int
+
+typedef TESTED_ALLOC<TESTED_TYPE>								t_alloc;
+typedef TESTED_NAMESPACE::list<TESTED_TYPE, t_alloc>			t_list;
+
+//Nodes spliced or merged out of a list must outlive it: with the same
+//allocator they are relinked, with another pool they are copied
+int		main(void)
+{
+	t_alloc	al;
+	t_list	*src = new t_list(al);
+	t_list	dst(al);
+
+	for (int i = 1; i <= 5; ++i)
+	{
+		src->push_back(i);
+		dst.push_back(i * 10);
+	}
+	std::cout << "same allocator: " << (src->get_allocator() == dst.get_allocator()) << std::endl;
+	dst.splice(++dst.begin(), *src, ++src->begin(), --src->end());
+	dst.splice(dst.end(), *src, src->begin());
+	printSize(*src);
+	dst.splice(dst.begin(), *src);
+	delete src;
+	printSize(dst);
+
+	t_list	other;
+	t_list	*tmp = new t_list;
+
+	for (int i = 0; i < 6; ++i)
+	{
+		other.push_back(i * 7);
+		tmp->push_back(i * 5);
+	}
+	other.splice(other.begin(), *tmp, ++tmp->begin());
+	other.splice(other.end(), *tmp, tmp->begin(), ++(++tmp->begin()));
+	printSize(*tmp);
+	other.splice(++other.begin(), *tmp);
+	delete tmp;
+	printSize(other);
+
+	tmp = new t_list;
+	for (int i = 0; i < 8; ++i)
+		tmp->push_back(i * 3);
+	other.sort();
+	other.merge(*tmp);
+	printSize(*tmp);
+	delete tmp;
+	printSize(other);
+
+	dst.sort();
+	dst.merge(other);
+	other.push_back(100);
+	printSize(dst);
+	printSize(other);
+	return (0);
+}
@@ -0,0 +1,118 @@
+#include "common.hpp"
+#include <memory>
+
+#define T1 int
+#define T2 int
+typedef _pair<const T1, T2> T3;
+
+//Counts what goes through each instance: a map must use the allocator it
+//was given (copies included), never a default constructed one
+struct Arena
+{
+	const char	*name;
+	long		allocated;
+	long		constructed;
+};
+
+template <typename T>
+class arena_allocator : public std::allocator<T>
+{
+	public:
+		typedef typename std::allocator<T>::pointer		pointer;
+		typedef typename std::allocator<T>::size_type	size_type;
+
+		template <typename U>
+		struct rebind
+		{ typedef arena_allocator<U> other; };
+
+		Arena	*arena;
+
+		explicit arena_allocator(Arena *a) : arena(a) {}
+
+		template <typename U>
+		arena_allocator(const arena_allocator<U> &src) : std::allocator<T>(), arena(src.arena) {}
+
+		pointer	allocate(size_type n, const void * = 0)
+		{
+			arena->allocated += n;
+			return (std::allocator<T>::allocate(n));
+		}
+
+		void	deallocate(pointer p, size_type n)
+		{
+			arena->allocated -= n;
+			std::allocator<T>::deallocate(p, n);
+		}
+
+		void	construct(pointer p, const T &val)
+		{
+			++arena->constructed;
+			std::allocator<T>::construct(p, val);
+		}
+
+		void	destroy(pointer p)
+		{
+			--arena->constructed;
+			std::allocator<T>::destroy(p);
+		}
+};
+
+template <typename T, typename U>
+bool	operator==(const arena_allocator<T> &x, const arena_allocator<U> &y)
+{ return (x.arena == y.arena); }
+
+template <typename T, typename U>
+bool	operator!=(const arena_allocator<T> &x, const arena_allocator<U> &y)
+{ return (x.arena != y.arena); }
+
+typedef TESTED_NAMESPACE::map<T1, T2, std::less<T1>, arena_allocator<T3> > arena_map;
+
+static void	printArena(const Arena &a)
+{
+	std::cout << a.name << ": " << a.allocated << " nodes, "
+		<< a.constructed << " values" << std::endl;
+}
+
+static void	printOwner(const arena_map &mp)
+{
+	std::cout << "owned by " << mp.get_allocator().arena->name << std::endl;
+}
+
+int		main(void)
+{
+	Arena			first = {"first", 0, 0};
+	Arena			second = {"second", 0, 0};
+	std::less<T1>	comp;
+
+	{
+		arena_map	mp1(comp, arena_allocator<T3>(&first));
+		arena_map	mp2(comp, arena_allocator<T3>(&second));
+
+		for (int i = 0; i < 10; ++i)
+			mp1.insert(T3(i, i * 2));
+		mp2[42] = 1;
+		printOwner(mp1);
+		printArena(first);
+		printArena(second);
+
+		arena_map	cpy(mp1);
+
+		printOwner(cpy);
+		printArena(first);
+
+		mp1.swap(mp2);
+		printOwner(mp1);
+		printOwner(mp2);
+		mp2.erase(3);
+		mp1.erase(42);
+		printArena(first);
+		printArena(second);
+
+		mp1 = cpy;
+		printOwner(mp1);
+		printSize(mp1);
+	}
+	printArena(first);
+	printArena(second);
+	return (0);
+}
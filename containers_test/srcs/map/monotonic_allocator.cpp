@@ -0,0 +1,114 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_monotonic_allocator.hpp"
+# define TESTED_ALLOC ft::monotonic_allocator
+# define ARENA_ALLOC(ar) (t_alloc(ar))
+typedef ft::arena	t_arena;
+#else
+# define TESTED_ALLOC std::allocator
+# define ARENA_ALLOC(ar) ((void)(ar), t_alloc())
+//std::allocator has no arena: nothing to release
+struct t_arena
+{
+	t_arena(void) {}
+	t_arena(void *, size_t) {}
+	void	release(void) {}
+};
+#endif
+
+#define T1 int
+#define T2 std::string
+typedef _pair<const T1, T2> T3;
+
+typedef TESTED_ALLOC<T3>												t_alloc;
+typedef TESTED_NAMESPACE::map<T1, T2, std::less<T1>, t_alloc>		t_map;
+
+//The allocator has no default constructor: an empty handle must not need
+//one. C++98 std::map has no node handles, the std side copies and erases
+#if !defined(USING_STD)
+typedef t_map::node_type	t_handle;
+
+static void	take(t_map &mp, const T1 &k, t_handle &nh)
+{ nh = mp.extract(k); }
+
+static bool	give(t_map &mp, t_handle &nh)
+{ return (mp.insert(nh).second); }
+#else
+struct t_handle
+{
+	bool	full;
+	T3		value;
+
+	t_handle(void) : full(false), value() {}
+
+	bool	empty(void) const
+	{ return (!full); }
+};
+
+static void	take(t_map &mp, const T1 &k, t_handle &nh)
+{
+	t_map::iterator	it = mp.find(k);
+
+	nh.full = (it != mp.end());
+	if (nh.full)
+	{
+		nh.value.~T3();
+		new (&nh.value) T3(*it);
+		mp.erase(it);
+	}
+}
+
+static bool	give(t_map &mp, t_handle &nh)
+{
+	if (nh.empty() || !mp.insert(nh.value).second)
+		return (false);
+	nh.full = false;
+	return (true);
+}
+#endif
+
+static void	fill(t_arena &ar, int n)
+{
+	t_map	mp(std::less<T1>(), ARENA_ALLOC(ar));
+	t_map	other(std::less<T1>(), ARENA_ALLOC(ar));
+
+	for (int i = 0; i < n; ++i)
+		mp[(i * 5) % (n + 3)] = std::string(i % 6 + 1, 'a' + i % 26);
+	other.insert(mp.begin(), mp.end());
+	mp.erase(mp.begin());
+	other.erase(++other.begin(), other.find((n / 2 * 5) % (n + 3)));
+
+	t_handle	nh;
+
+	std::cout << "handle empty: " << nh.empty() << std::endl;
+	take(mp, 5, nh);
+	std::cout << "handle empty: " << nh.empty() << std::endl;
+	std::cout << "to other: " << give(other, nh) << std::endl;
+
+	t_map	cpy(other);
+
+	std::cout << "copy shares the allocator: " << (cpy.get_allocator() == other.get_allocator()) << std::endl;
+	cpy[1000] = "copy";
+	mp.swap(cpy);
+	printSize(mp);
+	printSize(cpy);
+	printSize(other);
+}
+
+int		main(void)
+{
+	t_arena	ar;
+
+	fill(ar, 30);
+	ar.release();
+	fill(ar, 6);
+	ar.release();
+
+	char	buffer[2048];
+	t_arena	small(buffer, sizeof(buffer));
+
+	fill(small, 4);
+	small.release();
+	fill(small, 80);
+	return (0);
+}
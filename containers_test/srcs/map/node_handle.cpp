@@ -0,0 +1,154 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_pool_allocator.hpp"
+# define TESTED_ALLOC ft::pool_allocator
+#else
+# define TESTED_ALLOC std::allocator
+#endif
+
+#define T1 int
+#define T2 std::string
+typedef _pair<const T1, T2> T3;
+
+typedef TESTED_ALLOC<T3>												t_alloc;
+typedef TESTED_NAMESPACE::map<T1, T2, std::less<T1>, t_alloc>		t_map;
+
+//C++98 std::map has no node handles: the std side copies and erases the
+//element, which prints the same as relinking it
+#if !defined(USING_STD)
+typedef t_map::node_type	t_handle;
+
+static t_handle	extract(t_map &mp, t_map::iterator it)
+{ return (mp.extract(it)); }
+
+static t_handle	extract(t_map &mp, const T1 &k)
+{ return (mp.extract(k)); }
+
+static bool		reinsert(t_map &mp, t_handle &nh)
+{ return (mp.insert(nh).second); }
+
+//The handle returned by extract() goes straight into insert()
+static bool		move_key(t_map &from, t_map &to, const T1 &k)
+{ return (to.insert(from.extract(k)).second); }
+
+static T1		&handleKey(t_handle &nh)
+{ return (nh.key()); }
+
+static T2		&handleMapped(t_handle &nh)
+{ return (nh.value().second); }
+#else
+struct t_handle
+{
+	bool	full;
+	T1		key;
+	T2		mapped;
+
+	t_handle(void) : full(false), key(), mapped() {}
+
+	bool	empty(void) const
+	{ return (!full); }
+};
+
+static t_handle	extract(t_map &mp, t_map::iterator it)
+{
+	t_handle	nh;
+
+	nh.full = true;
+	nh.key = it->first;
+	nh.mapped = it->second;
+	mp.erase(it);
+	return (nh);
+}
+
+static t_handle	extract(t_map &mp, const T1 &k)
+{
+	t_map::iterator	it = mp.find(k);
+
+	if (it == mp.end())
+		return (t_handle());
+	return (extract(mp, it));
+}
+
+static bool		reinsert(t_map &mp, t_handle &nh)
+{
+	if (nh.empty() || !mp.insert(T3(nh.key, nh.mapped)).second)
+		return (false);
+	nh.full = false;
+	return (true);
+}
+
+static bool		move_key(t_map &from, t_map &to, const T1 &k)
+{
+	t_handle	nh = extract(from, k);
+
+	return (reinsert(to, nh));
+}
+
+static T1		&handleKey(t_handle &nh)
+{ return (nh.key); }
+
+static T2		&handleMapped(t_handle &nh)
+{ return (nh.mapped); }
+#endif
+
+static void	printHandle(t_handle &nh)
+{
+	std::cout << "handle empty: " << nh.empty();
+	if (!nh.empty())
+		std::cout << " | key: " << handleKey(nh) << " | value: " << handleMapped(nh);
+	std::cout << std::endl;
+}
+
+int		main(void)
+{
+	t_alloc	al;
+	t_map	mp(std::less<T1>(), al);
+	t_map	same(std::less<T1>(), al);
+	t_map	other;
+
+	for (int i = 0; i < 10; ++i)
+		mp[i * 3] = std::string(i + 1, 'a' + i);
+	same[100] = "hundred";
+	other[6] = "six";
+
+	t_handle	nh = extract(mp, 9);
+
+	printHandle(nh);
+	printSize(mp);
+	std::cout << "missing key: ";
+	t_handle	none = extract(mp, 10);
+	printHandle(none);
+	std::cout << "insert empty: " << reinsert(mp, none) << std::endl;
+
+	//The key may be changed while the node is out of the tree
+	handleKey(nh) = 10;
+	handleMapped(nh) += "-moved";
+	std::cout << "reinsert: " << reinsert(mp, nh) << std::endl;
+	printHandle(nh);
+	printSize(mp);
+
+	//A duplicate key is refused and the handle keeps its element
+	nh = extract(mp, mp.begin());
+	handleKey(nh) = 3;
+	std::cout << "duplicate: " << reinsert(mp, nh) << std::endl;
+	printHandle(nh);
+	handleKey(nh) = -1;
+	std::cout << "after renaming: " << reinsert(mp, nh) << std::endl;
+	printHandle(nh);
+
+	//Same allocator: the node is relinked, another one: it is copied
+	std::cout << "to same: " << move_key(mp, same, 12) << std::endl;
+	std::cout << "to other: " << move_key(mp, other, 15) << std::endl;
+	std::cout << "duplicate to other: " << move_key(mp, other, 6) << std::endl;
+	std::cout << "missing to other: " << move_key(mp, other, 42) << std::endl;
+	printSize(mp);
+	printSize(same);
+	printSize(other);
+
+	nh = extract(other, 15);
+	std::cout << "back from other: " << reinsert(mp, nh) << std::endl;
+	printHandle(nh);
+	printSize(mp);
+	printSize(other);
+	return (0);
+}
@@ -0,0 +1,92 @@
+//rank, select, count_range and size(first, last) only exist with it
+#define FT_RB_TREE_ORDER_STATISTICS
+#include "common.hpp"
+#include <iterator>
+
+#define T1 int
+#define T2 int
+typedef _pair<const T1, T2> T3;
+typedef TESTED_NAMESPACE::map<T1, T2>	t_map;
+
+//The std side computes the same values by walking the map
+#if !defined(USING_STD)
+static size_t	rank(const t_map &mp, const T1 &k)
+{ return (mp.rank(k)); }
+
+static t_map::const_iterator	select(const t_map &mp, size_t k)
+{ return (mp.select(k)); }
+
+static size_t	count_range(const t_map &mp, const T1 &lo, const T1 &hi)
+{ return (mp.count_range(lo, hi)); }
+
+static size_t	size(const t_map &mp, t_map::const_iterator first, t_map::const_iterator last)
+{ return (mp.size(first, last)); }
+#else
+static size_t	rank(const t_map &mp, const T1 &k)
+{ return (std::distance(mp.begin(), mp.lower_bound(k))); }
+
+static t_map::const_iterator	select(const t_map &mp, size_t k)
+{
+	t_map::const_iterator	it = mp.begin();
+
+	if (k >= mp.size())
+		return (mp.end());
+	std::advance(it, k);
+	return (it);
+}
+
+static size_t	count_range(const t_map &mp, const T1 &lo, const T1 &hi)
+{
+	if (!(lo < hi))
+		return (0);
+	return (std::distance(mp.lower_bound(lo), mp.lower_bound(hi)));
+}
+
+static size_t	size(const t_map &, t_map::const_iterator first, t_map::const_iterator last)
+{ return (std::distance(first, last)); }
+#endif
+
+static void	printStats(const t_map &mp)
+{
+	std::cout << "ranks:";
+	for (int k = -5; k <= 105; k += 11)
+		std::cout << " " << rank(mp, k);
+	std::cout << std::endl << "select:";
+	for (size_t i = 0; i < mp.size(); i += 3)
+		std::cout << " " << select(mp, i)->first;
+	std::cout << " end: " << (select(mp, mp.size()) == mp.end()) << std::endl;
+	std::cout << "count_range: " << count_range(mp, 10, 60) << " " << count_range(mp, 60, 10)
+		<< " " << count_range(mp, -100, 1000) << " " << count_range(mp, 33, 34) << std::endl;
+	std::cout << "size(first, last): " << size(mp, mp.begin(), mp.end())
+		<< " " << size(mp, mp.lower_bound(25), mp.upper_bound(75))
+		<< " " << size(mp, mp.find(50), mp.find(50)) << std::endl;
+}
+
+int		main(void)
+{
+	t_map	mp;
+
+	for (int i = 0; i < 50; ++i)
+		mp.insert(T3((i * 37) % 101, i));
+	printStats(mp);
+
+	//Sizes must follow erasures and rebalancing
+	for (int i = 0; i < 101; i += 4)
+		mp.erase(i);
+	mp.erase(mp.begin(), mp.find(select(mp, 5)->first));
+	printStats(mp);
+
+	//Copies, sorted range construction and assignment
+	t_map	cpy(mp);
+
+	for (int i = 200; i < 230; ++i)
+		cpy[i] = i;
+	printStats(cpy);
+	t_map	range(cpy.begin(), cpy.end());
+
+	mp = range;
+	mp.erase(mp.find(50), mp.end());
+	printStats(mp);
+	printSize(mp);
+	return (0);
+}
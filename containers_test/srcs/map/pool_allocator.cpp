@@ -0,0 +1,56 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_pool_allocator.hpp"
+# define TESTED_ALLOC ft::pool_allocator
+#else
+# define TESTED_ALLOC std::allocator
+#endif
+
+#define T1 int
+#define T2 std::string
+typedef _pair<const T1, T2> T3;
+
+typedef TESTED_ALLOC<T3>												t_alloc;
+typedef TESTED_NAMESPACE::map<T1, T2, std::less<T1>, t_alloc>		t_map;
+
+int		main(void)
+{
+	t_alloc	al;
+	t_map	mp(std::less<T1>(), al);
+
+	for (int i = 0; i < 20; ++i)
+		mp.insert(T3((i * 7) % 20, std::string(i + 1, 'a' + i)));
+	printSize(mp);
+
+	//Copies and rebinds share the pool for their whole life
+	t_map	*cpy = new t_map(mp);
+
+	std::cout << "copy shares the allocator: " << (cpy->get_allocator() == mp.get_allocator()) << std::endl;
+	std::cout << "rebind shares the allocator: "
+		<< (TESTED_ALLOC<long>(mp.get_allocator()) == TESTED_ALLOC<long>(al)) << std::endl;
+	for (int i = 0; i < 20; i += 3)
+		mp.erase(i);
+	mp.erase(mp.begin());
+	cpy->erase(++cpy->begin(), --cpy->end());
+	(*cpy)[42] = "forty-two";
+	printSize(mp);
+	printSize(*cpy);
+
+	t_map	other(std::less<T1>(), al);
+
+	other[-1] = "minus one";
+	other.swap(*cpy);
+	std::cout << "swapped allocators still equal: " << (other.get_allocator() == cpy->get_allocator()) << std::endl;
+	delete cpy;
+	printSize(other);
+
+	mp.clear();
+	printSize(mp);
+	for (int i = 0; i < 5; ++i)
+		mp[i] = "refill";
+	mp = other;
+	printSize(mp);
+	other.clear();
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,33 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef _pair<const T1, T2> T3;
+
+static bool	int_greater(int a, int b)
+{
+	return (a > b);
+}
+
+int		main(void)
+{
+	//An empty comparator and allocator must cost nothing: the map is only
+	//its header and element count
+#if !defined(USING_STD)
+	const size_t	bare = sizeof(ft::Rb_tree_node_base) + sizeof(size_t);
+#else
+	const size_t	bare = sizeof(std::map<T1, T2>);
+#endif
+	std::cout << "map<int, int> is bare: "
+		<< (sizeof(TESTED_NAMESPACE::map<T1, T2>) <= bare) << std::endl;
+	//A function pointer comparator is kept as a member
+	std::cout << "map<int, int, bool (*)(int, int)> adds one pointer at most: "
+		<< (sizeof(TESTED_NAMESPACE::map<T1, T2, bool (*)(int, int)>) <= bare + sizeof(void *)) << std::endl;
+
+	TESTED_NAMESPACE::map<T1, T2, bool (*)(int, int)> mp(int_greater);
+
+	for (int i = 0; i < 5; ++i)
+		mp.insert(T3(i, i * 3));
+	printSize(mp);
+	return (0);
+}
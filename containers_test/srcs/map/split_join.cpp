@@ -0,0 +1,78 @@
+//split() needs the subtree sizes
+#define FT_RB_TREE_ORDER_STATISTICS
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef _pair<const T1, T2> T3;
+typedef TESTED_NAMESPACE::map<T1, T2>	t_map;
+
+//C++98 std::map has neither: the std side moves the elements one by one
+#if !defined(USING_STD)
+static void	split(t_map &mp, const T1 &k, t_map &upper)
+{ mp.split(k, upper); }
+
+static bool	join(t_map &mp, t_map &upper)
+{ return (mp.join(upper)); }
+#else
+static void	split(t_map &mp, const T1 &k, t_map &upper)
+{
+	upper.clear();
+	upper.insert(mp.lower_bound(k), mp.end());
+	mp.erase(mp.lower_bound(k), mp.end());
+}
+
+static bool	join(t_map &mp, t_map &upper)
+{
+	if (!mp.empty() && !upper.empty() && !(mp.rbegin()->first < upper.begin()->first))
+		return (false);
+	mp.insert(upper.begin(), upper.end());
+	upper.clear();
+	return (true);
+}
+#endif
+
+int		main(void)
+{
+	t_map	mp;
+	t_map	upper;
+
+	for (int i = 0; i < 40; ++i)
+		mp[i * 5] = std::string(i % 7 + 1, 'a' + i % 26);
+	upper[-1] = "cleared by split";
+
+	//The upper half moves, whatever upper held is dropped
+	split(mp, 100, upper);
+	printSize(mp);
+	printSize(upper);
+	printReverse(upper);
+
+	//Keys between two elements, before the first and past the last
+	t_map	tail;
+
+	split(upper, 151, tail);
+	std::cout << "sizes: " << upper.size() << " " << tail.size() << std::endl;
+	split(tail, -10, upper);
+	std::cout << "sizes: " << tail.size() << " " << upper.size() << std::endl;
+	split(upper, 1000, tail);
+	std::cout << "sizes: " << upper.size() << " " << tail.size() << std::endl;
+
+	//Overlapping keys are refused, both maps stay as they are
+	t_map	overlap;
+
+	overlap[50] = "overlap";
+	overlap[500] = "after";
+	std::cout << "join overlap: " << join(mp, overlap) << std::endl;
+	printSize(overlap);
+	std::cout << "join upper: " << join(mp, upper) << std::endl;
+	std::cout << "join empty: " << join(mp, tail) << std::endl;
+	std::cout << "join into empty: " << join(tail, overlap) << std::endl;
+	printSize(mp);
+	printSize(tail);
+	printSize(overlap);
+
+	split(mp, 60, upper);
+	std::cout << "join back: " << join(mp, upper) << std::endl;
+	printReverse(mp);
+	return (0);
+}
@@ -0,0 +1,103 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_pool_allocator.hpp"
+# define TESTED_ALLOC ft::pool_allocator
+#else
+# define TESTED_ALLOC std::allocator
+#endif
+
+#define T1 int
+#define T2 std::string
+typedef _pair<const T1, T2> T3;
+
+typedef TESTED_ALLOC<T3>													t_alloc;
+typedef TESTED_NAMESPACE::multimap<T1, T2, std::less<T1>, t_alloc>	t_map;
+
+//C++98 std::multimap has no node handles: the std side copies and erases
+//the element, which prints the same as relinking it after its equals
+#if !defined(USING_STD)
+typedef t_map::node_type	t_handle;
+
+static t_handle	extract(t_map &mp, t_map::iterator it)
+{ return (mp.extract(it)); }
+
+static t_map::iterator	reinsert(t_map &mp, t_handle &nh)
+{ return (mp.insert(nh)); }
+
+//The handle returned by extract() goes straight into insert()
+static t_map::iterator	move_key(t_map &from, t_map &to, const T1 &k)
+{ return (to.insert(from.extract(k))); }
+
+static T1		&handleKey(t_handle &nh)
+{ return (nh.key()); }
+#else
+struct t_handle
+{
+	bool	full;
+	T1		key;
+	T2		mapped;
+
+	t_handle(void) : full(false), key(), mapped() {}
+
+	bool	empty(void) const
+	{ return (!full); }
+};
+
+static t_handle	extract(t_map &mp, t_map::iterator it)
+{
+	t_handle	nh;
+
+	nh.full = true;
+	nh.key = it->first;
+	nh.mapped = it->second;
+	mp.erase(it);
+	return (nh);
+}
+
+static t_map::iterator	reinsert(t_map &mp, t_handle &nh)
+{
+	if (nh.empty())
+		return (mp.end());
+	nh.full = false;
+	return (mp.insert(T3(nh.key, nh.mapped)));
+}
+
+static t_map::iterator	move_key(t_map &from, t_map &to, const T1 &k)
+{
+	t_handle	nh = extract(from, from.find(k));
+
+	return (reinsert(to, nh));
+}
+
+static T1		&handleKey(t_handle &nh)
+{ return (nh.key); }
+#endif
+
+int		main(void)
+{
+	t_alloc	al;
+	t_map	mp(std::less<T1>(), al);
+	t_map	same(std::less<T1>(), al);
+	t_map	other;
+
+	for (int i = 0; i < 12; ++i)
+		mp.insert(T3(i % 4, std::string(i + 1, 'a' + i)));
+	other.insert(T3(2, "other"));
+
+	//Equal keys: the node goes after its equals
+	t_handle	nh = extract(mp, mp.begin());
+
+	std::cout << "handle empty: " << nh.empty() << std::endl;
+	handleKey(nh) = 3;
+	printPair(reinsert(mp, nh));
+	std::cout << "handle empty: " << nh.empty() << std::endl;
+	printSize(mp);
+
+	printPair(move_key(mp, same, 1));
+	printPair(move_key(mp, other, 2));
+	printPair(move_key(mp, other, 2));
+	printSize(mp);
+	printSize(same);
+	printSize(other);
+	return (0);
+}
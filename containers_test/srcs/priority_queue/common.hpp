@@ -0,0 +1,40 @@
+#include "../base.hpp"
+#include <functional>
+#include <vector>
+#if !defined(USING_STD)
+# include "queue.hpp"
+# include "vector.hpp"
+# define T_PRIORITY_QUEUE(T, C, D) ft::priority_queue<T, ft::vector<T>, C, D>
+#else
+# include <queue>
+# define T_PRIORITY_QUEUE(T, C, D) std::priority_queue<T, std::vector<T>, C>
+#endif /* !defined(STD) */
+
+//push_range is an ft extension: std::priority_queue pushes one by one
+#if !defined(USING_STD)
+template <typename T_PQ, typename Iterator>
+void	pushRange(T_PQ &pq, Iterator first, Iterator last)
+{ pq.push_range(first, last); }
+#else
+template <typename T_PQ, typename Iterator>
+void	pushRange(T_PQ &pq, Iterator first, Iterator last)
+{
+	for (; first != last; ++first)
+		pq.push(*first);
+}
+#endif
+
+template <typename T_PQ>
+void	printSize(T_PQ &pq, bool print_content = 1)
+{
+	std::cout << "size: " << pq.size() << std::endl;
+	if (print_content)
+	{
+		std::cout << std::endl << "Content was:" << std::endl;
+		while (pq.size() != 0) {
+			std::cout << "- " << pq.top() << std::endl;
+			pq.pop();
+		}
+	}
+	std::cout << "###############################################" << std::endl;
+}
@@ -0,0 +1,50 @@
+#include "common.hpp"
+
+//The heap order must not depend on the arity
+static unsigned	g_seed = 7;
+
+static int	next_value(void)
+{
+	g_seed = g_seed * 1103515245 + 12345;
+	return (static_cast<int>((g_seed >> 8) % 1000));
+}
+
+template <typename T_PQ>
+void	run(void)
+{
+	T_PQ	pq;
+
+	for (int i = 0; i < 200; ++i)
+		pq.push(next_value());
+	std::cout << "top: " << pq.top() << std::endl;
+	for (int i = 0; i < 150; ++i)
+	{
+		if (i % 10 == 0)
+			std::cout << "pop " << pq.top() << std::endl;
+		pq.pop();
+	}
+	for (int i = 0; i < 30; ++i)
+		pq.push(next_value());
+	printSize(pq);
+	pq.push(5);
+	std::cout << "single: " << pq.top() << " " << pq.size() << std::endl;
+	pq.pop();
+	std::cout << "empty: " << pq.empty() << std::endl;
+}
+
+int		main(void)
+{
+	run<T_PRIORITY_QUEUE(int, std::less<int>, 2)>();
+	run<T_PRIORITY_QUEUE(int, std::less<int>, 3)>();
+	run<T_PRIORITY_QUEUE(int, std::less<int>, 4)>();
+	run<T_PRIORITY_QUEUE(int, std::greater<int>, 2)>();
+	run<T_PRIORITY_QUEUE(int, std::greater<int>, 3)>();
+	run<T_PRIORITY_QUEUE(int, std::greater<int>, 4)>();
+
+	T_PRIORITY_QUEUE(std::string, std::less<std::string>, 3)	strs;
+
+	for (int i = 0; i < 26; ++i)
+		strs.push(std::string(i % 4 + 1, 'a' + (i * 7) % 26));
+	printSize(strs);
+	return (0);
+}
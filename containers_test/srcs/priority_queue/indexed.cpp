@@ -0,0 +1,163 @@
+#include "common.hpp"
+
+//ft::indexed_priority_queue has no std counterpart: the std side runs the
+//same operations on a linear scan queue with the same handle reuse (the
+//last freed handle first). Priorities are distinct, so both agree on top()
+#if !defined(USING_STD)
+# define T_INDEXED(T, C, D) ft::indexed_priority_queue<T, C, D>
+#else
+template <typename T, typename Compare>
+class Naive_indexed_queue
+{
+	public:
+		typedef size_t	handle_type;
+
+	private:
+		std::vector<T>				_values;
+		std::vector<bool>			_in;
+		std::vector<handle_type>	_free;
+		size_t						_size;
+		Compare						_comp;
+
+	public:
+		Naive_indexed_queue() : _size(0) {}
+
+		bool	empty() const
+		{ return (_size == 0); }
+
+		size_t	size() const
+		{ return (_size); }
+
+		handle_type	top_handle() const
+		{
+			handle_type	best = _in.size();
+
+			for (handle_type h = 0; h < _in.size(); ++h)
+				if (_in[h] && (best == _in.size() || _comp(_values[best], _values[h])))
+					best = h;
+			return (best);
+		}
+
+		const T	&top() const
+		{ return (_values[top_handle()]); }
+
+		bool	contains(handle_type h) const
+		{ return (h < _in.size() && _in[h]); }
+
+		const T	&value(handle_type h) const
+		{ return (_values[h]); }
+
+		handle_type	push(const T &val)
+		{
+			handle_type	h;
+
+			if (_free.empty())
+			{
+				h = _values.size();
+				_values.push_back(val);
+				_in.push_back(true);
+			}
+			else
+			{
+				h = _free.back();
+				_free.pop_back();
+				_values[h] = val;
+				_in[h] = true;
+			}
+			++_size;
+			return (h);
+		}
+
+		void	erase(handle_type h)
+		{
+			_in[h] = false;
+			_free.push_back(h);
+			--_size;
+		}
+
+		void	pop()
+		{ erase(top_handle()); }
+
+		void	decrease_key(handle_type h, const T &val)
+		{ _values[h] = val; }
+
+		void	update(handle_type h, const T &val)
+		{ _values[h] = val; }
+
+		void	clear()
+		{
+			_values.clear();
+			_in.clear();
+			_free.clear();
+			_size = 0;
+		}
+};
+# define T_INDEXED(T, C, D) Naive_indexed_queue<T, C>
+#endif
+
+template <typename T_IPQ>
+void	popAll(T_IPQ &pq)
+{
+	std::cout << "size: " << pq.size() << std::endl;
+	while (!pq.empty())
+	{
+		std::cout << "- [" << pq.top_handle() << "] " << pq.top() << std::endl;
+		pq.pop();
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+//A scheduler: smallest deadline first. With std::less the values are
+//negated (sign -1), so decrease_key still moves them toward the top
+template <typename T_IPQ>
+void	run(int sign)
+{
+	T_IPQ	pq;
+	size_t	h[20];
+
+	for (int i = 0; i < 20; ++i)
+		h[i] = pq.push(sign * ((i * 7) % 20 * 10 + 100));
+	std::cout << "top: [" << pq.top_handle() << "] " << pq.top() << std::endl;
+
+	//Deadlines moved earlier
+	pq.decrease_key(h[3], sign * 5);
+	pq.decrease_key(h[12], sign * 15);
+	pq.decrease_key(h[19], sign * 99);
+	std::cout << "top: [" << pq.top_handle() << "] " << pq.top() << std::endl;
+
+	//Either way
+	pq.update(h[3], sign * 1000);
+	pq.update(h[0], sign * 3);
+	pq.update(h[7], sign * 111);
+	std::cout << "top: [" << pq.top_handle() << "] " << pq.top() << std::endl;
+	std::cout << "value: " << pq.value(h[7]) << " " << pq.value(h[3]) << std::endl;
+
+	pq.erase(h[0]);
+	pq.erase(h[5]);
+	pq.erase(h[18]);
+	std::cout << "contains: " << pq.contains(h[0]) << pq.contains(h[5])
+		<< pq.contains(h[6]) << pq.contains(100) << std::endl;
+	for (int i = 0; i < 4; ++i)
+	{
+		std::cout << "pop [" << pq.top_handle() << "] " << pq.top() << std::endl;
+		pq.pop();
+	}
+
+	//Freed handles come back
+	for (int i = 0; i < 5; ++i)
+		std::cout << "reused handle " << pq.push(sign * (2000 + i)) << std::endl;
+	popAll(pq);
+
+	pq.clear();
+	std::cout << "after clear: " << pq.push(sign * 42) << " " << pq.push(sign * 41) << std::endl;
+	popAll(pq);
+}
+
+int		main(void)
+{
+	run<T_INDEXED(int, std::greater<int>, 2)>(1);
+	run<T_INDEXED(int, std::greater<int>, 3)>(1);
+	run<T_INDEXED(int, std::greater<int>, 4)>(1);
+	run<T_INDEXED(int, std::less<int>, 4)>(-1);
+	return (0);
+}
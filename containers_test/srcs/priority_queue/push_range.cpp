@@ -0,0 +1,37 @@
+#include "common.hpp"
+
+//A few elements are sifted up one by one, many rebuild the heap: both
+//must pop in the same order
+template <typename T_PQ>
+void	run(void)
+{
+	std::vector<int>	values;
+
+	for (int i = 0; i < 300; ++i)
+		values.push_back((i * 37) % 101);
+
+	T_PQ	pq(values.begin(), values.begin() + 50);
+
+	pushRange(pq, values.begin() + 50, values.begin() + 53);
+	std::cout << "few: " << pq.size() << " top " << pq.top() << std::endl;
+	pushRange(pq, values.begin() + 53, values.end());
+	std::cout << "many: " << pq.size() << " top " << pq.top() << std::endl;
+	pushRange(pq, values.begin(), values.begin());
+	for (int i = 0; i < 280; ++i)
+		pq.pop();
+	printSize(pq);
+
+	T_PQ	empty;
+
+	pushRange(empty, values.begin() + 10, values.begin() + 20);
+	printSize(empty);
+}
+
+int		main(void)
+{
+	run<T_PRIORITY_QUEUE(int, std::less<int>, 2)>();
+	run<T_PRIORITY_QUEUE(int, std::less<int>, 3)>();
+	run<T_PRIORITY_QUEUE(int, std::less<int>, 4)>();
+	run<T_PRIORITY_QUEUE(int, std::greater<int>, 4)>();
+	return (0);
+}
@@ -0,0 +1,58 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_monotonic_allocator.hpp"
+# define TESTED_ALLOC ft::monotonic_allocator
+# define ARENA_ALLOC(ar) (t_alloc(ar))
+typedef ft::arena	t_arena;
+#else
+# define TESTED_ALLOC std::allocator
+# define ARENA_ALLOC(ar) ((void)(ar), t_alloc())
+//std::allocator has no arena: nothing to release
+struct t_arena
+{
+	t_arena(void) {}
+	t_arena(void *, size_t) {}
+	void	release(void) {}
+};
+#endif
+
+#define T1 std::string
+
+typedef TESTED_ALLOC<T1>										t_alloc;
+typedef TESTED_NAMESPACE::set<T1, std::less<T1>, t_alloc>	t_set;
+
+//Erased nodes stay in the arena until release()
+static void	fill(t_arena &ar, int n)
+{
+	t_set	st(std::less<T1>(), ARENA_ALLOC(ar));
+	t_set	other(std::less<T1>(), ARENA_ALLOC(ar));
+
+	for (int i = 0; i < n; ++i)
+		st.insert(std::string((i * 7) % 13 + 1, 'a' + i % 5));
+	other.insert(st.begin(), st.end());
+	other.erase(other.begin());
+	st.erase(++st.begin(), --st.end());
+	st.insert("inserted");
+	st.swap(other);
+	std::cout << "swapped allocators still equal: " << (other.get_allocator() == st.get_allocator()) << std::endl;
+	printSize(st);
+	printSize(other);
+}
+
+int		main(void)
+{
+	t_arena	ar;
+
+	fill(ar, 40);
+	ar.release();
+	fill(ar, 8);
+
+	char	buffer[1024];
+	t_arena	small(buffer, sizeof(buffer));
+
+	fill(small, 3);
+	small.release();
+	fill(small, 60);
+	small.release();
+	return (0);
+}
@@ -0,0 +1,135 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_pool_allocator.hpp"
+# define TESTED_ALLOC ft::pool_allocator
+#else
+# define TESTED_ALLOC std::allocator
+#endif
+
+#define T1 std::string
+
+typedef TESTED_ALLOC<T1>										t_alloc;
+typedef TESTED_NAMESPACE::set<T1, std::less<T1>, t_alloc>	t_set;
+
+//C++98 std::set has no node handles: the std side copies and erases the
+//element, which prints the same as relinking it
+#if !defined(USING_STD)
+typedef t_set::node_type	t_handle;
+
+static t_handle	extract(t_set &st, t_set::iterator it)
+{ return (st.extract(it)); }
+
+static t_handle	extract(t_set &st, const T1 &val)
+{ return (st.extract(val)); }
+
+static bool		reinsert(t_set &st, t_handle &nh)
+{ return (st.insert(nh).second); }
+
+//The handle returned by extract() goes straight into insert()
+static bool		move_value(t_set &from, t_set &to, const T1 &val)
+{ return (to.insert(from.extract(val)).second); }
+
+static T1		&handleValue(t_handle &nh)
+{ return (nh.value()); }
+#else
+struct t_handle
+{
+	bool	full;
+	T1		value;
+
+	t_handle(void) : full(false), value() {}
+
+	bool	empty(void) const
+	{ return (!full); }
+};
+
+static t_handle	extract(t_set &st, t_set::iterator it)
+{
+	t_handle	nh;
+
+	nh.full = true;
+	nh.value = *it;
+	st.erase(it);
+	return (nh);
+}
+
+static t_handle	extract(t_set &st, const T1 &val)
+{
+	t_set::iterator	it = st.find(val);
+
+	if (it == st.end())
+		return (t_handle());
+	return (extract(st, it));
+}
+
+static bool		reinsert(t_set &st, t_handle &nh)
+{
+	if (nh.empty() || !st.insert(nh.value).second)
+		return (false);
+	nh.full = false;
+	return (true);
+}
+
+static bool		move_value(t_set &from, t_set &to, const T1 &val)
+{
+	t_handle	nh = extract(from, val);
+
+	return (reinsert(to, nh));
+}
+
+static T1		&handleValue(t_handle &nh)
+{ return (nh.value); }
+#endif
+
+static void	printHandle(t_handle &nh)
+{
+	std::cout << "handle empty: " << nh.empty();
+	if (!nh.empty())
+		std::cout << " | value: " << handleValue(nh);
+	std::cout << std::endl;
+}
+
+int		main(void)
+{
+	t_alloc	al;
+	t_set	st(std::less<T1>(), al);
+	t_set	same(std::less<T1>(), al);
+	t_set	other;
+
+	for (int i = 0; i < 8; ++i)
+		st.insert(std::string(i + 1, 'a' + i));
+	same.insert("same");
+	other.insert("ccc");
+
+	t_handle	nh = extract(st, "dddd");
+
+	printHandle(nh);
+	printSize(st);
+	t_handle	none = extract(st, "missing");
+	printHandle(none);
+	std::cout << "insert empty: " << reinsert(st, none) << std::endl;
+
+	//The value is the key, it may be changed while out of the tree
+	handleValue(nh) = "zzz";
+	std::cout << "reinsert: " << reinsert(st, nh) << std::endl;
+	printHandle(nh);
+
+	//A duplicate is refused and the handle keeps its element
+	nh = extract(st, st.begin());
+	handleValue(nh) = "bb";
+	std::cout << "duplicate: " << reinsert(st, nh) << std::endl;
+	printHandle(nh);
+	handleValue(nh) = "0";
+	std::cout << "after renaming: " << reinsert(st, nh) << std::endl;
+	printSize(st);
+
+	//Same allocator: the node is relinked, another one: it is copied
+	std::cout << "to same: " << move_value(st, same, "eeeee") << std::endl;
+	std::cout << "to other: " << move_value(st, other, "ffffff") << std::endl;
+	std::cout << "duplicate to other: " << move_value(st, other, "ccc") << std::endl;
+	std::cout << "missing to other: " << move_value(st, other, "missing") << std::endl;
+	printSize(st);
+	printSize(same);
+	printSize(other);
+	return (0);
+}
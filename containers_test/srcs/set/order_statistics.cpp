@@ -0,0 +1,84 @@
+//rank, select, count_range and size(first, last) only exist with it
+#define FT_RB_TREE_ORDER_STATISTICS
+#include "common.hpp"
+#include <iterator>
+
+#define T1 std::string
+typedef TESTED_NAMESPACE::set<T1>	t_set;
+
+//The std side computes the same values by walking the set
+#if !defined(USING_STD)
+static size_t	rank(const t_set &st, const T1 &val)
+{ return (st.rank(val)); }
+
+static t_set::const_iterator	select(const t_set &st, size_t k)
+{ return (st.select(k)); }
+
+static size_t	count_range(const t_set &st, const T1 &lo, const T1 &hi)
+{ return (st.count_range(lo, hi)); }
+
+static size_t	size(const t_set &st, t_set::const_iterator first, t_set::const_iterator last)
+{ return (st.size(first, last)); }
+#else
+static size_t	rank(const t_set &st, const T1 &val)
+{ return (std::distance(st.begin(), st.lower_bound(val))); }
+
+static t_set::const_iterator	select(const t_set &st, size_t k)
+{
+	t_set::const_iterator	it = st.begin();
+
+	if (k >= st.size())
+		return (st.end());
+	std::advance(it, k);
+	return (it);
+}
+
+static size_t	count_range(const t_set &st, const T1 &lo, const T1 &hi)
+{
+	if (!(lo < hi))
+		return (0);
+	return (std::distance(st.lower_bound(lo), st.lower_bound(hi)));
+}
+
+static size_t	size(const t_set &, t_set::const_iterator first, t_set::const_iterator last)
+{ return (std::distance(first, last)); }
+#endif
+
+static void	printStats(const t_set &st)
+{
+	const char	*probes[] = {"", "a", "b", "cc", "f", "m", "mm", "q", "z", "zzzz"};
+
+	std::cout << "ranks:";
+	for (size_t i = 0; i < sizeof(probes) / sizeof(*probes); ++i)
+		std::cout << " " << rank(st, probes[i]);
+	std::cout << std::endl << "select:";
+	for (size_t i = 0; i < st.size(); i += 4)
+		std::cout << " " << *select(st, i);
+	std::cout << " end: " << (select(st, st.size()) == st.end()) << std::endl;
+	std::cout << "count_range: " << count_range(st, "c", "p") << " " << count_range(st, "p", "c")
+		<< " " << count_range(st, "", "zzzz") << std::endl;
+	std::cout << "size(first, last): " << size(st, st.begin(), st.end())
+		<< " " << size(st, st.lower_bound("e"), st.upper_bound("s")) << std::endl;
+}
+
+int		main(void)
+{
+	t_set	st;
+
+	for (int i = 0; i < 60; ++i)
+		st.insert(std::string(i % 4 + 1, 'a' + (i * 7) % 26));
+	printStats(st);
+
+	for (int i = 0; i < 26; i += 3)
+		st.erase(std::string(1, 'a' + i));
+	st.erase(st.begin(), st.find(*select(st, 6)));
+	printStats(st);
+
+	t_set	cpy(st);
+
+	cpy.insert("zz");
+	cpy.insert("aaa");
+	printStats(cpy);
+	printSize(cpy);
+	return (0);
+}
@@ -0,0 +1,52 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_pool_allocator.hpp"
+# define TESTED_ALLOC ft::pool_allocator
+#else
+# define TESTED_ALLOC std::allocator
+#endif
+
+#define T1 std::string
+
+typedef TESTED_ALLOC<T1>										t_alloc;
+typedef TESTED_NAMESPACE::set<T1, std::less<T1>, t_alloc>	t_set;
+
+int		main(void)
+{
+	t_alloc	al;
+	t_set	st(std::less<T1>(), al);
+
+	for (int i = 0; i < 20; ++i)
+		st.insert(std::string((i * 7) % 20 + 1, 'a' + i % 5));
+	printSize(st);
+
+	//Copies and rebinds share the pool for their whole life
+	t_set	*cpy = new t_set(st);
+
+	std::cout << "copy shares the allocator: " << (cpy->get_allocator() == st.get_allocator()) << std::endl;
+	std::cout << "rebind shares the allocator: "
+		<< (TESTED_ALLOC<long>(st.get_allocator()) == TESTED_ALLOC<long>(al)) << std::endl;
+	st.erase(st.begin());
+	st.erase(std::string(8, 'd'));
+	cpy->erase(++cpy->begin(), --cpy->end());
+	cpy->insert("inserted");
+	printSize(st);
+	printSize(*cpy);
+
+	t_set	other(std::less<T1>(), al);
+
+	other.insert("other");
+	other.swap(*cpy);
+	std::cout << "swapped allocators still equal: " << (other.get_allocator() == cpy->get_allocator()) << std::endl;
+	delete cpy;
+	printSize(other);
+
+	st.clear();
+	printSize(st);
+	st.insert("refill");
+	st = other;
+	printSize(st);
+	other.clear();
+	printSize(st);
+	return (0);
+}
@@ -0,0 +1,31 @@
+#include "common.hpp"
+
+#define T1 int
+
+static bool	int_greater(int a, int b)
+{
+	return (a > b);
+}
+
+int		main(void)
+{
+	//An empty comparator and allocator must cost nothing: the set is only
+	//its header and element count
+#if !defined(USING_STD)
+	const size_t	bare = sizeof(ft::Rb_tree_node_base) + sizeof(size_t);
+#else
+	const size_t	bare = sizeof(std::set<T1>);
+#endif
+	std::cout << "set<int> is bare: "
+		<< (sizeof(TESTED_NAMESPACE::set<T1>) <= bare) << std::endl;
+	//A function pointer comparator is kept as a member
+	std::cout << "set<int, bool (*)(int, int)> adds one pointer at most: "
+		<< (sizeof(TESTED_NAMESPACE::set<T1, bool (*)(int, int)>) <= bare + sizeof(void *)) << std::endl;
+
+	TESTED_NAMESPACE::set<T1, bool (*)(int, int)> st(int_greater);
+
+	for (int i = 0; i < 5; ++i)
+		st.insert(i * 3);
+	printSize(st);
+	return (0);
+}
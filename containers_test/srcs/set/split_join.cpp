@@ -0,0 +1,68 @@
+//split() needs the subtree sizes
+#define FT_RB_TREE_ORDER_STATISTICS
+#include "common.hpp"
+
+#define T1 std::string
+typedef TESTED_NAMESPACE::set<T1>	t_set;
+
+//C++98 std::set has neither: the std side moves the elements one by one
+#if !defined(USING_STD)
+static void	split(t_set &st, const T1 &val, t_set &upper)
+{ st.split(val, upper); }
+
+static bool	join(t_set &st, t_set &upper)
+{ return (st.join(upper)); }
+#else
+static void	split(t_set &st, const T1 &val, t_set &upper)
+{
+	upper.clear();
+	upper.insert(st.lower_bound(val), st.end());
+	st.erase(st.lower_bound(val), st.end());
+}
+
+static bool	join(t_set &st, t_set &upper)
+{
+	if (!st.empty() && !upper.empty() && !(*st.rbegin() < *upper.begin()))
+		return (false);
+	st.insert(upper.begin(), upper.end());
+	upper.clear();
+	return (true);
+}
+#endif
+
+int		main(void)
+{
+	t_set	st;
+	t_set	upper;
+
+	for (int i = 0; i < 26; ++i)
+		st.insert(std::string(i % 3 + 1, 'a' + i));
+	upper.insert("cleared by split");
+
+	split(st, "m", upper);
+	printSize(st);
+	printSize(upper);
+
+	t_set	tail;
+
+	split(upper, "t", tail);
+	std::cout << "sizes: " << upper.size() << " " << tail.size() << std::endl;
+	split(tail, "A", upper);
+	std::cout << "sizes: " << tail.size() << " " << upper.size() << std::endl;
+	split(upper, "zzzz", tail);
+	std::cout << "sizes: " << upper.size() << " " << tail.size() << std::endl;
+
+	//Overlapping values are refused, both sets stay as they are
+	t_set	overlap;
+
+	overlap.insert("b");
+	overlap.insert("zz");
+	std::cout << "join overlap: " << join(st, overlap) << std::endl;
+	printSize(overlap);
+	std::cout << "join upper: " << join(st, upper) << std::endl;
+	std::cout << "join empty: " << join(st, tail) << std::endl;
+	std::cout << "join self: " << join(st, st) << std::endl;
+	printSize(st);
+	printSize(overlap);
+	return (0);
+}
@@ -0,0 +1,46 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_pool_allocator.hpp"
+# define TESTED_ALLOC ft::pool_allocator
+#else
+# define TESTED_ALLOC std::allocator
+#endif
+
+#define TESTED_TYPE int
+#define N 4
+
+typedef TESTED_ALLOC<TESTED_TYPE>							t_alloc;
+typedef T_SMALL_VECTOR_ALLOC(TESTED_TYPE, N, t_alloc)		t_vct;
+
+//The vector allocates from the allocator it was given, and its copies and
+//swaps carry that allocator along
+int		main(void)
+{
+	t_alloc	first;
+	t_alloc	second;
+	t_vct	x(first);
+	t_vct	y(second);
+
+	for (int i = 0; i < 10; ++i)
+		x.push_back(i);
+	y.push_back(100);
+	std::cout << "x uses first: " << (t_alloc(x.get_allocator()) == first) << std::endl;
+
+	t_vct	*cpy = new t_vct(x);
+
+	std::cout << "copy uses first: " << (t_alloc(cpy->get_allocator()) == first) << std::endl;
+	printSize(*cpy);
+	delete cpy;
+
+	x.swap(y);
+	std::cout << "x uses second: " << (t_alloc(x.get_allocator()) == second) << std::endl;
+	std::cout << "y uses first: " << (t_alloc(y.get_allocator()) == first) << std::endl;
+	y.push_back(10);
+	x.push_back(101);
+	printSize(x);
+	printSize(y);
+	y.swap(x);
+	printSize(x);
+	printSize(y);
+	return (0);
+}
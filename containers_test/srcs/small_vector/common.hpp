@@ -0,0 +1,53 @@
+#include "../base.hpp"
+#if !defined(USING_STD)
+# include "small_vector.hpp"
+# define T_SMALL_VECTOR(T, N) ft::small_vector<T, N>
+# define T_SMALL_VECTOR_ALLOC(T, N, A) ft::small_vector<T, N, A>
+#else
+# include <vector>
+# define T_SMALL_VECTOR(T, N) std::vector<T>
+# define T_SMALL_VECTOR_ALLOC(T, N, A) std::vector<T, A>
+#endif /* !defined(STD) */
+
+//std::vector has no inline buffer: it stands for a small_vector holding its
+//elements inline exactly when they fit, which is what the tests check
+#if !defined(USING_STD)
+template <typename T_VCT>
+bool	isInline(T_VCT const &vct, size_t)
+{ return (vct.is_inline()); }
+#else
+template <typename T_VCT>
+bool	isInline(T_VCT const &vct, size_t n)
+{ return (vct.size() <= n); }
+#endif
+
+//shrink_to_fit() is C++11: the std side uses the swap trick
+#if !defined(USING_STD)
+template <typename T_VCT>
+void	shrinkToFit(T_VCT &vct)
+{ vct.shrink_to_fit(); }
+#else
+template <typename T_VCT>
+void	shrinkToFit(T_VCT &vct)
+{ T_VCT(vct).swap(vct); }
+#endif
+
+template <typename T_VCT>
+void	printSize(T_VCT const &vct, bool print_content = true)
+{
+	const typename T_VCT::size_type size = vct.size();
+	const typename T_VCT::size_type capacity = vct.capacity();
+	const std::string isCapacityOk = (capacity >= size) ? "OK" : "KO";
+
+	std::cout << "size: " << size << std::endl;
+	std::cout << "capacity: " << isCapacityOk << std::endl;
+	if (print_content)
+	{
+		typename T_VCT::const_iterator it = vct.begin();
+		typename T_VCT::const_iterator ite = vct.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << *it << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
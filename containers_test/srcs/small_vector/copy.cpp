@@ -0,0 +1,57 @@
+#include "common.hpp"
+
+#define TESTED_TYPE std::string
+#define N 4
+
+typedef T_SMALL_VECTOR(TESTED_TYPE, N)	t_vct;
+
+static void	printVct(const char *name, t_vct const &vct)
+{
+	std::cout << name << " inline: " << isInline(vct, N) << std::endl;
+	printSize(vct);
+}
+
+int		main(void)
+{
+	t_vct	inl;
+	t_vct	heap;
+
+	for (int i = 0; i < 3; ++i)
+		inl.push_back(std::string(i + 1, 'a' + i));
+	for (int i = 0; i < 10; ++i)
+		heap.push_back(std::string(20, 'k' + i));
+	printVct("inl", inl);
+	printVct("heap", heap);
+
+	//Copies get their own buffer, never the source's
+	t_vct	cpy_inl(inl);
+	t_vct	cpy_heap(heap);
+
+	cpy_inl[0] = "changed";
+	cpy_heap[0] = "changed";
+	cpy_inl.push_back("pushed");
+	printVct("cpy_inl", cpy_inl);
+	printVct("inl", inl);
+	printVct("cpy_heap", cpy_heap);
+	printVct("heap", heap);
+	std::cout << "equal: " << (cpy_inl == inl) << " " << (t_vct(heap) == heap) << std::endl;
+
+	//Assignment keeps the buffer of the destination
+	t_vct	dst;
+
+	dst = heap;
+	printVct("dst = heap", dst);
+	dst = inl;
+	printSize(dst);
+	shrinkToFit(dst);
+	printVct("dst = inl", dst);
+	inl = cpy_heap;
+	printVct("inl = cpy_heap", inl);
+
+	t_vct	range(cpy_heap.begin() + 2, cpy_heap.begin() + 5);
+	t_vct	fill(2, "fill");
+
+	printVct("range", range);
+	printVct("fill", fill);
+	return (0);
+}
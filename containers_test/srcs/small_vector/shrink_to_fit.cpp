@@ -0,0 +1,48 @@
+#include "common.hpp"
+
+#define TESTED_TYPE int
+#define N 8
+
+typedef T_SMALL_VECTOR(TESTED_TYPE, N)	t_vct;
+
+int		main(void)
+{
+	t_vct	vct;
+
+	for (int i = 0; i < N; ++i)
+		vct.push_back(i * 3);
+	std::cout << "inline: " << isInline(vct, N) << std::endl;
+	vct.push_back(42);
+	std::cout << "inline: " << isInline(vct, N) << std::endl;
+	printSize(vct);
+
+	//Past N: a tighter heap block
+	for (int i = 0; i < 20; ++i)
+		vct.push_back(i);
+	vct.erase(vct.begin() + 10, vct.end());
+	shrinkToFit(vct);
+	std::cout << "inline: " << isInline(vct, N) << std::endl;
+	std::cout << "capacity == size: " << (vct.capacity() == vct.size()) << std::endl;
+	printSize(vct);
+
+	//Back to the inline buffer once they fit
+	vct.erase(vct.begin(), vct.begin() + 5);
+	shrinkToFit(vct);
+	std::cout << "inline: " << isInline(vct, N) << std::endl;
+	printSize(vct);
+	vct.insert(vct.begin() + 2, 3, -1);
+	std::cout << "inline: " << isInline(vct, N) << std::endl;
+	printSize(vct);
+
+	t_vct	other(vct.rbegin(), vct.rend());
+
+	std::cout << "== " << (vct == other) << " != " << (vct != other)
+		<< " < " << (vct < other) << " <= " << (vct <= other)
+		<< " > " << (vct > other) << " >= " << (vct >= other) << std::endl;
+	other.assign(vct.begin(), vct.end());
+	std::cout << "== " << (vct == other) << " <= " << (vct <= other) << std::endl;
+	vct.clear();
+	shrinkToFit(vct);
+	printSize(vct);
+	return (0);
+}
@@ -0,0 +1,64 @@
+#include "common.hpp"
+
+#define TESTED_TYPE std::string
+#define N 4
+
+typedef T_SMALL_VECTOR(TESTED_TYPE, N)	t_vct;
+
+static void	fill(t_vct &vct, int n, char c)
+{
+	for (int i = 0; i < n; ++i)
+		vct.push_back(std::string(i + 1, c));
+}
+
+static void	printBoth(t_vct const &x, t_vct const &y)
+{
+	std::cout << "x inline: " << isInline(x, N) << std::endl;
+	printSize(x);
+	std::cout << "y inline: " << isInline(y, N) << std::endl;
+	printSize(y);
+}
+
+int		main(void)
+{
+	t_vct	x;
+	t_vct	y;
+
+	std::cout << "INLINE / INLINE" << std::endl;
+	fill(x, 1, 'a');
+	fill(y, 4, 'b');
+	x.swap(y);
+	printBoth(x, y);
+	TESTED_NAMESPACE::swap(x, y);
+	printBoth(x, y);
+
+	std::cout << "INLINE / HEAP" << std::endl;
+	fill(y, 5, 'c');
+	x.swap(y);
+	printBoth(x, y);
+	y.swap(x);
+	printBoth(x, y);
+	x.push_back("after swap");
+	y.push_back("after swap");
+	printBoth(x, y);
+
+	std::cout << "HEAP / HEAP" << std::endl;
+	fill(x, 8, 'd');
+	t_vct::const_iterator	it_x = x.begin();
+	t_vct::const_iterator	it_y = y.begin();
+
+	x.swap(y);
+	printBoth(x, y);
+	std::cout << "Iterator validity:" << std::endl;
+	std::cout << (it_x == y.begin()) << std::endl;
+	std::cout << (it_y == x.begin()) << std::endl;
+
+	std::cout << "EMPTY / HEAP" << std::endl;
+	t_vct	empty;
+
+	empty.swap(x);
+	printBoth(empty, x);
+	x.swap(x);
+	printBoth(x, y);
+	return (0);
+}
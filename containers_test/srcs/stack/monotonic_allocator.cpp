@@ -0,0 +1,63 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "vector.hpp"
+# include "ft_monotonic_allocator.hpp"
+# define TESTED_ALLOC ft::monotonic_allocator
+# define ARENA_ALLOC(ar) (t_alloc(ar))
+typedef ft::arena	t_arena;
+#else
+# include <vector>
+# define TESTED_ALLOC std::allocator
+# define ARENA_ALLOC(ar) ((void)(ar), t_alloc())
+//std::allocator has no arena: nothing to release
+struct t_arena
+{
+	t_arena(void) {}
+	t_arena(void *, size_t) {}
+	void	release(void) {}
+};
+#endif
+
+#define TESTED_TYPE int
+
+typedef TESTED_ALLOC<TESTED_TYPE>									t_alloc;
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE, t_alloc>			container_type;
+typedef TESTED_NAMESPACE::stack<TESTED_TYPE, container_type>	t_stack;
+
+//The stack gets the arena through the container it is built from
+static void	fill(t_arena &ar, int n)
+{
+	t_stack	stck((container_type(ARENA_ALLOC(ar))));
+
+	for (int i = 0; i < n; ++i)
+		stck.push(i * 3);
+	for (int i = 0; i < n / 2; ++i)
+		stck.pop();
+	stck.push(-1);
+
+	t_stack	cpy(stck);
+
+	cpy.push(42);
+	std::cout << "top: " << stck.top() << " | copy top: " << cpy.top() << std::endl;
+	std::cout << "equal: " << (stck == cpy) << " | less: " << (stck < cpy) << std::endl;
+	printSize(stck);
+	printSize(cpy);
+}
+
+int		main(void)
+{
+	t_arena	ar;
+
+	fill(ar, 25);
+	ar.release();
+	fill(ar, 4);
+
+	char	buffer[256];
+	t_arena	small(buffer, sizeof(buffer));
+
+	fill(small, 10);
+	small.release();
+	fill(small, 200);
+	small.release();
+	return (0);
+}
@@ -0,0 +1,89 @@
+#include "../base.hpp"
+#include <map>
+#if !defined(USING_STD)
+# include "unordered_map.hpp"
+# define TESTED_MAP ft::unordered_map
+#else
+# define TESTED_MAP std::map
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+//The iteration order of ft::unordered_map is unspecified: its elements are
+//sorted through a std::map first, which std::map leaves as they are
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	typedef std::map<typename T_MAP::key_type, typename T_MAP::mapped_type>	sorted_map;
+	sorted_map	sorted;
+	size_t		iterated = 0;
+
+	for (typename T_MAP::const_iterator it = mp.begin(); it != mp.end(); ++it, ++iterated)
+		sorted.insert(typename sorted_map::value_type(it->first, it->second));
+	std::cout << "size: " << mp.size() << std::endl;
+	std::cout << "iterated: " << iterated << " | distinct: " << sorted.size() << std::endl;
+	if (print_content)
+	{
+		typename sorted_map::const_iterator it = sorted.begin(), ite = sorted.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+//Bucket interface of ft::unordered_map; std::map has none, its side only
+//states the invariants the ft side checks
+#if !defined(USING_STD)
+template <typename T_MAP>
+bool	checkLoad(T_MAP const &mp)
+{
+	return (mp.load_factor() <= mp.max_load_factor()
+		&& (mp.bucket_count() == 0 || mp.bucket_count() > mp.size()));
+}
+
+template <typename T_MAP>
+bool	bucketsAtLeast(T_MAP const &mp, size_t n)
+{ return (mp.bucket_count() >= n); }
+
+template <typename T_MAP>
+void	rehash(T_MAP &mp, size_t n)
+{ mp.rehash(n); }
+
+template <typename T_MAP>
+void	reserve(T_MAP &mp, size_t n)
+{ mp.reserve(n); }
+
+template <typename T_MAP>
+void	maxLoadFactor(T_MAP &mp, float z)
+{ mp.max_load_factor(z); }
+#else
+template <typename T_MAP>
+bool	checkLoad(T_MAP const &)
+{ return (true); }
+
+template <typename T_MAP>
+bool	bucketsAtLeast(T_MAP const &, size_t)
+{ return (true); }
+
+template <typename T_MAP>
+void	rehash(T_MAP &, size_t)
+{}
+
+template <typename T_MAP>
+void	reserve(T_MAP &, size_t)
+{}
+
+template <typename T_MAP>
+void	maxLoadFactor(T_MAP &, float)
+{}
+#endif
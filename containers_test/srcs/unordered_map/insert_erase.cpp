@@ -0,0 +1,50 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+typedef _pair<const T1, T2> T3;
+
+typedef TESTED_MAP<T1, T2>	t_map;
+
+//Keys sharing their low bits collide on weak hashes: Robin Hood moves the
+//runs around on insertion and shifts them back on erasure
+int		main(void)
+{
+	t_map	mp;
+
+	for (int i = 0; i < 64; ++i)
+		mp.insert(T3(i * 1024, std::string(i % 7 + 1, 'a' + i % 26)));
+	printSize(mp);
+	std::cout << "load: " << checkLoad(mp) << std::endl;
+
+	_pair<t_map::iterator, bool>	ret = mp.insert(T3(5 * 1024, "dup"));
+
+	std::cout << "insert dup: " << ret.second << " | " << ret.first->second << std::endl;
+	ret = mp.insert(T3(-3, "negative"));
+	std::cout << "insert new: " << ret.second << " | " << ret.first->second << std::endl;
+
+	for (int i = 0; i < 64; i += 3)
+		std::cout << "erase " << i * 1024 << ": " << mp.erase(i * 1024) << std::endl;
+	std::cout << "erase missing: " << mp.erase(7) << std::endl;
+	printSize(mp);
+	for (int i = 0; i < 64; ++i)
+		if (mp.count(i * 1024) != (i % 3 != 0))
+			std::cout << "lost key " << i * 1024 << std::endl;
+
+	//Erase by iterator, then put some back
+	t_map::iterator	it = mp.find(1024);
+
+	mp.erase(it);
+	mp.erase(mp.find(-3));
+	for (int i = 0; i < 64; i += 6)
+		mp[i * 1024] = "back";
+	mp.insert(mp.begin(), T3(77, "hint"));
+	printSize(mp);
+
+	while (!mp.empty())
+		mp.erase(mp.begin());
+	printSize(mp);
+	mp[1] = "one";
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,50 @@
+#include "common.hpp"
+
+#define T1 std::string
+#define T2 int
+typedef _pair<const T1, T2> T3;
+
+typedef TESTED_MAP<T1, T2>	t_map;
+
+int		main(void)
+{
+	t_map	mp;
+
+	for (int i = 0; i < 40; ++i)
+		mp[std::string(i % 4 + 1, 'a' + i % 26) + "_" + std::string(1, '0' + i % 10)] = i;
+	printSize(mp);
+
+	//Writing through iterators
+	for (t_map::iterator it = mp.begin(); it != mp.end(); ++it)
+		it->second *= 2;
+	int	sum = 0;
+
+	for (t_map::const_iterator it = mp.begin(); it != mp.end(); it++)
+		sum += (*it).second;
+	std::cout << "sum: " << sum << std::endl;
+
+	_pair<t_map::iterator, t_map::iterator>	range = mp.equal_range("ff_5");
+
+	std::cout << "equal_range: " << (range.first != mp.end()) << " "
+		<< std::distance(range.first, range.second) << " " << range.first->second << std::endl;
+	range = mp.equal_range("missing");
+	std::cout << "equal_range missing: " << (range.first == range.second) << std::endl;
+
+	t_map const	cpy(mp);
+	t_map		asg;
+
+	asg["zz"] = 1;
+	asg = cpy;
+	std::cout << "copies: " << cpy.size() << " " << asg.size() << " "
+		<< cpy.count("a_0") << " " << asg.find("ccc_2")->second << std::endl;
+
+	t_map	other(cpy.begin(), cpy.end());
+
+	other.erase(other.begin(), other.end());
+	std::cout << "range erase: " << other.empty() << std::endl;
+	other["x"] = 3;
+	other.swap(asg);
+	printSize(other, false);
+	printSize(asg);
+	return (0);
+}
@@ -0,0 +1,65 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+typedef _pair<const T1, T2> T3;
+
+typedef TESTED_MAP<T1, T2>	t_map;
+
+static void	check(t_map const &mp, int n, int step)
+{
+	bool	ok = (static_cast<int>(mp.size()) == n);
+
+	for (int i = 0; i < n && ok; ++i)
+	{
+		t_map::const_iterator	it = mp.find(i * step);
+
+		ok = (it != mp.end() && it->second == i);
+	}
+	std::cout << "size: " << mp.size() << " | found all: " << ok
+		<< " | load: " << checkLoad(mp) << std::endl;
+}
+
+int		main(void)
+{
+	t_map	mp;
+
+	reserve(mp, 100);
+	std::cout << "reserved: " << bucketsAtLeast(mp, 100) << std::endl;
+	for (int i = 0; i < 100; ++i)
+		mp.insert(T3(i * 17, i));
+	check(mp, 100, 17);
+
+	//Growing past the reservation
+	for (int i = 100; i < 1000; ++i)
+		mp.insert(T3(i * 17, i));
+	check(mp, 1000, 17);
+
+	rehash(mp, 4096);
+	std::cout << "rehashed: " << bucketsAtLeast(mp, 4096) << std::endl;
+	check(mp, 1000, 17);
+	rehash(mp, 0);
+	check(mp, 1000, 17);
+
+	maxLoadFactor(mp, 0.5f);
+	check(mp, 1000, 17);
+	maxLoadFactor(mp, 0.95f);
+	for (int i = 1000; i < 3000; ++i)
+		mp.insert(T3(i * 17, i));
+	check(mp, 3000, 17);
+	maxLoadFactor(mp, 10.0f);
+	check(mp, 3000, 17);
+	maxLoadFactor(mp, 0.0f);
+	check(mp, 3000, 17);
+
+	mp.erase(mp.find(0));
+	mp.erase(17 * 2999);
+	std::cout << "size: " << mp.size() << std::endl;
+	mp.clear();
+	std::cout << "cleared: " << mp.empty() << " | " << (mp.begin() == mp.end()) << std::endl;
+	for (int i = 0; i < 50; ++i)
+		mp[i * 3] = i;
+	check(mp, 50, 3);
+	printSize(mp);
+	return (0);
+}
@@ -0,0 +1,89 @@
+#include "../base.hpp"
+#include <set>
+#if !defined(USING_STD)
+# include "unordered_set.hpp"
+# define TESTED_SET ft::unordered_set
+#else
+# define TESTED_SET std::set
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "value: " << *iterator;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+//The iteration order of ft::unordered_set is unspecified: its elements are
+//sorted through a std::set first, which std::set leaves as they are
+template <typename T_SET>
+void	printSize(T_SET const &st, bool print_content = 1)
+{
+	typedef std::set<typename T_SET::key_type>	sorted_set;
+	sorted_set	sorted;
+	size_t		iterated = 0;
+
+	for (typename T_SET::const_iterator it = st.begin(); it != st.end(); ++it, ++iterated)
+		sorted.insert(*it);
+	std::cout << "size: " << st.size() << std::endl;
+	std::cout << "iterated: " << iterated << " | distinct: " << sorted.size() << std::endl;
+	if (print_content)
+	{
+		typename sorted_set::const_iterator it = sorted.begin(), ite = sorted.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+//Bucket interface of ft::unordered_set; std::set has none, its side only
+//states the invariants the ft side checks
+#if !defined(USING_STD)
+template <typename T_SET>
+bool	checkLoad(T_SET const &st)
+{
+	return (st.load_factor() <= st.max_load_factor()
+		&& (st.bucket_count() == 0 || st.bucket_count() > st.size()));
+}
+
+template <typename T_SET>
+bool	bucketsAtLeast(T_SET const &st, size_t n)
+{ return (st.bucket_count() >= n); }
+
+template <typename T_SET>
+void	rehash(T_SET &st, size_t n)
+{ st.rehash(n); }
+
+template <typename T_SET>
+void	reserve(T_SET &st, size_t n)
+{ st.reserve(n); }
+
+template <typename T_SET>
+void	maxLoadFactor(T_SET &st, float z)
+{ st.max_load_factor(z); }
+#else
+template <typename T_SET>
+bool	checkLoad(T_SET const &)
+{ return (true); }
+
+template <typename T_SET>
+bool	bucketsAtLeast(T_SET const &, size_t)
+{ return (true); }
+
+template <typename T_SET>
+void	rehash(T_SET &, size_t)
+{}
+
+template <typename T_SET>
+void	reserve(T_SET &, size_t)
+{}
+
+template <typename T_SET>
+void	maxLoadFactor(T_SET &, float)
+{}
+#endif
@@ -0,0 +1,45 @@
+#include "common.hpp"
+
+#define T1 int
+
+typedef TESTED_SET<T1>	t_set;
+
+//Keys sharing their low bits collide on weak hashes: Robin Hood moves the
+//runs around on insertion and shifts them back on erasure
+int		main(void)
+{
+	t_set	st;
+
+	for (int i = 0; i < 64; ++i)
+		st.insert(i * 1024);
+	printSize(st);
+	std::cout << "load: " << checkLoad(st) << std::endl;
+
+	_pair<t_set::iterator, bool>	ret = st.insert(5 * 1024);
+
+	std::cout << "insert dup: " << ret.second << " | " << *ret.first << std::endl;
+	ret = st.insert(-3);
+	std::cout << "insert new: " << ret.second << " | " << *ret.first << std::endl;
+
+	for (int i = 0; i < 64; i += 3)
+		std::cout << "erase " << i * 1024 << ": " << st.erase(i * 1024) << std::endl;
+	std::cout << "erase missing: " << st.erase(7) << std::endl;
+	printSize(st);
+	for (int i = 0; i < 64; ++i)
+		if (st.count(i * 1024) != (i % 3 != 0))
+			std::cout << "lost key " << i * 1024 << std::endl;
+
+	st.erase(st.find(1024));
+	st.erase(st.find(-3));
+	for (int i = 0; i < 64; i += 6)
+		st.insert(i * 1024);
+	st.insert(st.begin(), 77);
+	printSize(st);
+
+	while (!st.empty())
+		st.erase(st.begin());
+	printSize(st);
+	st.insert(1);
+	printSize(st);
+	return (0);
+}
@@ -0,0 +1,45 @@
+#include "common.hpp"
+
+#define T1 std::string
+
+typedef TESTED_SET<T1>	t_set;
+
+int		main(void)
+{
+	t_set	st;
+
+	for (int i = 0; i < 40; ++i)
+		st.insert(std::string(i % 4 + 1, 'a' + i % 26) + "_" + std::string(1, '0' + i % 10));
+	printSize(st);
+
+	size_t	len = 0;
+
+	for (t_set::const_iterator it = st.begin(); it != st.end(); it++)
+		len += it->size();
+	std::cout << "total length: " << len << std::endl;
+
+	_pair<t_set::iterator, t_set::iterator>	range = st.equal_range("ff_5");
+
+	std::cout << "equal_range: " << (range.first != st.end()) << " "
+		<< std::distance(range.first, range.second) << " " << *range.first << std::endl;
+	range = st.equal_range("missing");
+	std::cout << "equal_range missing: " << (range.first == range.second) << std::endl;
+
+	t_set const	cpy(st);
+	t_set		asg;
+
+	asg.insert("zz");
+	asg = cpy;
+	std::cout << "copies: " << cpy.size() << " " << asg.size() << " "
+		<< cpy.count("a_0") << " " << *asg.find("ccc_2") << std::endl;
+
+	t_set	other(cpy.begin(), cpy.end());
+
+	other.erase(other.begin(), other.end());
+	std::cout << "range erase: " << other.empty() << std::endl;
+	other.insert("x");
+	other.swap(asg);
+	printSize(other, false);
+	printSize(asg);
+	return (0);
+}
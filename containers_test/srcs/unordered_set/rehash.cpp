@@ -0,0 +1,59 @@
+#include "common.hpp"
+
+#define T1 int
+
+typedef TESTED_SET<T1>	t_set;
+
+static void	check(t_set const &st, int n, int step)
+{
+	bool	ok = (static_cast<int>(st.size()) == n);
+
+	for (int i = 0; i < n && ok; ++i)
+		ok = (st.find(i * step) != st.end());
+	std::cout << "size: " << st.size() << " | found all: " << ok
+		<< " | load: " << checkLoad(st) << std::endl;
+}
+
+int		main(void)
+{
+	t_set	st;
+
+	reserve(st, 100);
+	std::cout << "reserved: " << bucketsAtLeast(st, 100) << std::endl;
+	for (int i = 0; i < 100; ++i)
+		st.insert(i * 17);
+	check(st, 100, 17);
+
+	//Growing past the reservation
+	for (int i = 100; i < 1000; ++i)
+		st.insert(i * 17);
+	check(st, 1000, 17);
+
+	rehash(st, 4096);
+	std::cout << "rehashed: " << bucketsAtLeast(st, 4096) << std::endl;
+	check(st, 1000, 17);
+	rehash(st, 0);
+	check(st, 1000, 17);
+
+	maxLoadFactor(st, 0.5f);
+	check(st, 1000, 17);
+	maxLoadFactor(st, 0.95f);
+	for (int i = 1000; i < 3000; ++i)
+		st.insert(i * 17);
+	check(st, 3000, 17);
+	maxLoadFactor(st, 10.0f);
+	check(st, 3000, 17);
+	maxLoadFactor(st, 0.0f);
+	check(st, 3000, 17);
+
+	st.erase(st.find(0));
+	st.erase(17 * 2999);
+	std::cout << "size: " << st.size() << std::endl;
+	st.clear();
+	std::cout << "cleared: " << st.empty() << " | " << (st.begin() == st.end()) << std::endl;
+	for (int i = 0; i < 50; ++i)
+		st.insert(i * 3);
+	check(st, 50, 3);
+	printSize(st);
+	return (0);
+}
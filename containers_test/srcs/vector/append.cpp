@@ -0,0 +1,74 @@
+#include "common.hpp"
+#include <iterator>
+#include <list>
+#include <sstream>
+
+//vector::append is an ft extension: std::vector appends with insert(end())
+#if !defined(USING_STD)
+template <typename T_VCT, typename Iterator>
+void	append(T_VCT &vct, Iterator first, Iterator last)
+{ vct.append(first, last); }
+#else
+template <typename T_VCT, typename Iterator>
+void	append(T_VCT &vct, Iterator first, Iterator last)
+{ vct.insert(vct.end(), first, last); }
+#endif
+
+template <typename T_VCT>
+void	printSample(T_VCT const &vct, size_t step)
+{
+	std::cout << "size: " << vct.size() << " | capacity: "
+		<< (vct.capacity() >= vct.size() ? "OK" : "KO") << std::endl;
+	for (size_t i = 0; i < vct.size(); i += step)
+		std::cout << "[" << i << "] " << vct[i] << std::endl;
+	std::cout << "back: " << vct.back() << std::endl;
+}
+
+int		main(void)
+{
+	//push_back through many reallocations, starting from empty and from
+	//a reserved vector
+	TESTED_NAMESPACE::vector<int>			ints;
+	TESTED_NAMESPACE::vector<std::string>	strs;
+
+	for (int i = 0; i < 5000; ++i)
+		ints.push_back(i * 7);
+	printSample(ints, 611);
+	strs.reserve(3);
+	for (int i = 0; i < 300; ++i)
+		strs.push_back(std::string(i % 13 + 1, 'a' + i % 26));
+	printSample(strs, 37);
+
+	//push_back of an element of the vector itself, at full capacity
+	TESTED_NAMESPACE::vector<std::string>	self(1, "self");
+
+	for (int i = 0; i < 10; ++i)
+		self.push_back(self[0] + self.back());
+	printSize(self);
+
+	//append from input, forward and random access ranges
+	std::istringstream		in("1 2 3 4 5 6 7 8 9 10 11 12");
+	std::istream_iterator<int>	in_first(in), in_last;
+	std::list<std::string>	lst;
+	const int				arr[] = {-1, -2, -3, -4, -5};
+
+	for (int i = 0; i < 20; ++i)
+		lst.push_back(std::string(i + 1, 'z' - i));
+
+	TESTED_NAMESPACE::vector<int>	small;
+
+	append(small, in_first, in_last);
+	printSize(small);
+	append(small, arr, arr + 5);
+	append(small, arr, arr);
+	printSize(small);
+	append(strs, lst.begin(), lst.end());
+	printSample(strs, 29);
+
+	TESTED_NAMESPACE::vector<std::string>	empty;
+
+	append(empty, lst.begin(), lst.end());
+	append(empty, strs.begin() + 3, strs.begin() + 9);
+	printSize(empty);
+	return (0);
+}
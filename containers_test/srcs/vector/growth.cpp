@@ -0,0 +1,104 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_growth_policy.hpp"
+# define T_VECTOR(T, G) ft::vector<T, std::allocator<T>, G>
+#else
+namespace ft
+{
+	struct growth_double {};
+	struct growth_1_5 {};
+	struct growth_exact {};
+	struct growth_page {};
+	struct growth_size_class {};
+}
+# define T_VECTOR(T, G) std::vector<T>
+#endif
+
+//The capacities after a full push_back and after reserve() are the ones
+//of the policy; std::vector has no policy, its side only states it
+#if !defined(USING_STD)
+template <typename G, typename T_VCT>
+bool	checkPush(T_VCT &vct, const typename T_VCT::value_type &val)
+{
+	vct.reserve(vct.size());
+	while (vct.size() < vct.capacity())
+		vct.push_back(val);
+
+	const size_t	size = vct.size();
+
+	vct.push_back(val);
+	return (vct.capacity() == G::grow(size, size + 1, sizeof(val)));
+}
+
+template <typename G, typename T_VCT>
+bool	checkReserve(size_t n)
+{
+	T_VCT	vct;
+
+	vct.reserve(n);
+	return (vct.capacity() >= n && vct.capacity() == G::round_up(n, sizeof(typename T_VCT::value_type)));
+}
+#else
+template <typename G, typename T_VCT>
+bool	checkPush(T_VCT &vct, const typename T_VCT::value_type &val)
+{
+	vct.push_back(val);
+	return (true);
+}
+
+template <typename G, typename T_VCT>
+bool	checkReserve(size_t n)
+{
+	T_VCT	vct;
+
+	vct.reserve(n);
+	return (vct.capacity() >= n);
+}
+#endif
+
+template <typename T_VCT>
+void	printSample(T_VCT const &vct, size_t step)
+{
+	std::cout << "size: " << vct.size() << " | capacity: "
+		<< (vct.capacity() >= vct.size() ? "OK" : "KO") << std::endl;
+	for (size_t i = 0; i < vct.size(); i += step)
+		std::cout << "[" << i << "] " << vct[i] << std::endl;
+}
+
+template <typename G, typename T>
+void	run(const char *name, const T &a, const T &b)
+{
+	typedef T_VECTOR(T, G)	t_vct;
+	t_vct	vct;
+
+	std::cout << "### " << name << std::endl;
+	for (int i = 0; i < 2000; ++i)
+		vct.push_back(i % 2 ? a : b);
+	printSample(vct, 397);
+	std::cout << "push: " << checkPush<G>(vct, a) << std::endl;
+	std::cout << "reserve: " << checkReserve<G, t_vct>(1000) << " "
+		<< checkReserve<G, t_vct>(4097) << std::endl;
+
+	t_vct	other(vct.begin(), vct.begin() + 300);
+
+	other.insert(other.begin() + 100, 700, b);
+	other.insert(other.begin() + 50, vct.begin(), vct.begin() + 900);
+	other.insert(other.end() - 1, a);
+	printSample(other, 211);
+	other.resize(5000, a);
+	other.erase(other.begin() + 10, other.end() - 10);
+	printSize(other);
+}
+
+int		main(void)
+{
+	run<ft::growth_double>("double", 1, 2);
+	run<ft::growth_1_5>("1.5", 3, 4);
+	run<ft::growth_exact>("exact", 5, 6);
+	run<ft::growth_page>("page", 7, 8);
+	run<ft::growth_size_class>("size class", 9, 10);
+	run<ft::growth_1_5>("1.5", std::string("a"), std::string(30, 'b'));
+	run<ft::growth_exact>("exact", std::string("c"), std::string(30, 'd'));
+	run<ft::growth_size_class>("size class", std::string("e"), std::string(30, 'f'));
+	return (0);
+}
@@ -0,0 +1,105 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_monotonic_allocator.hpp"
+# define TESTED_ALLOC ft::monotonic_allocator
+# define ARENA_ALLOC(ar) (t_alloc(ar))
+typedef ft::arena	t_arena;
+#else
+# define TESTED_ALLOC std::allocator
+# define ARENA_ALLOC(ar) ((void)(ar), t_alloc())
+//std::allocator has no arena: nothing to release
+struct t_arena
+{
+	t_arena(void) {}
+	t_arena(void *, size_t) {}
+	void	release(void) {}
+};
+#endif
+
+#define TESTED_TYPE std::string
+
+typedef TESTED_ALLOC<TESTED_TYPE>								t_alloc;
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE, t_alloc>		t_vct;
+
+//max_size() follows the allocator, it is left out
+static void	printContent(t_vct const &vct)
+{
+	std::cout << "size: " << vct.size() << " | capacity: "
+		<< (vct.capacity() >= vct.size() ? "OK" : "KO") << std::endl;
+	for (t_vct::const_iterator it = vct.begin(); it != vct.end(); ++it)
+		std::cout << "- " << *it << std::endl;
+	std::cout << "###############################################" << std::endl;
+}
+
+//The vector drops its old blocks on the arena when it grows, and still
+//destroys its elements (strings own heap memory of their own)
+static void	fill(t_arena &ar, int n)
+{
+	t_vct	vct(ARENA_ALLOC(ar));
+
+	for (int i = 0; i < n; ++i)
+		vct.push_back(std::string(i % 7 + 1, 'a' + i % 26));
+	vct.insert(vct.begin() + 2, 3, "inserted");
+	vct.erase(vct.begin() + 1, vct.begin() + 4);
+
+	t_vct	cpy(vct);
+
+	std::cout << "copy shares the allocator: " << (cpy.get_allocator() == vct.get_allocator()) << std::endl;
+	cpy.resize(4);
+	vct.swap(cpy);
+	printContent(vct);
+	printContent(cpy);
+}
+
+//Requests near max_size() must throw, not wrap around the arena's size
+//arithmetic and come back as a small block
+static void	oversized(t_arena &ar)
+{
+	TESTED_NAMESPACE::vector<char, TESTED_ALLOC<char> >	vct(ARENA_ALLOC(ar));
+	TESTED_ALLOC<char>									al(vct.get_allocator());
+
+	try
+	{
+		vct.reserve(vct.max_size());
+		std::cout << "reserve(max_size()): capacity " << vct.capacity() << std::endl;
+	}
+	catch (std::bad_alloc &)
+	{
+		std::cout << "reserve(max_size()): bad_alloc" << std::endl;
+	}
+	try
+	{
+		al.allocate(al.max_size() + 1);
+		std::cout << "allocate(max_size() + 1): returned" << std::endl;
+	}
+	catch (std::bad_alloc &)
+	{
+		std::cout << "allocate(max_size() + 1): bad_alloc" << std::endl;
+	}
+	vct.resize(1000, 'x');
+	std::cout << "size: " << vct.size() << " | back: " << vct.back() << std::endl;
+}
+
+int		main(void)
+{
+	t_arena	ar;
+
+	fill(ar, 30);
+	ar.release();
+	fill(ar, 12);
+	ar.release();
+
+	//The first blocks come from the caller's buffer, the rest from the heap
+	char	buffer[512];
+	t_arena	small(buffer, sizeof(buffer));
+
+	fill(small, 5);
+	small.release();
+	fill(small, 100);
+	small.release();
+	fill(small, 3);
+	small.release();
+	oversized(ar);
+	oversized(small);
+	return (0);
+}
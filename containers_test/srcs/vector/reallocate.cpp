@@ -0,0 +1,64 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_realloc_allocator.hpp"
+# define MALLOC_ALLOC ft::malloc_allocator
+# define MMAP_ALLOC ft::mmap_allocator
+#else
+# define MALLOC_ALLOC std::allocator
+# define MMAP_ALLOC std::allocator
+#endif
+
+//int vectors on reallocating allocators grow their block in place
+//(realloc, mremap), std::string ones take the usual copy path
+template <typename T_VCT>
+void	printSample(T_VCT const &vct, size_t step)
+{
+	long	sum = 0;
+
+	for (size_t i = 0; i < vct.size(); ++i)
+		sum += vct[i] % 1000;
+	std::cout << "size: " << vct.size() << " | capacity: "
+		<< (vct.capacity() >= vct.size() ? "OK" : "KO") << " | sum: " << sum << std::endl;
+	for (size_t i = 0; i < vct.size(); i += step)
+		std::cout << "[" << i << "] " << vct[i] << std::endl;
+}
+
+template <typename T_VCT>
+void	grow(void)
+{
+	T_VCT	vct;
+
+	for (int i = 0; i < 100000; ++i)
+		vct.push_back(i);
+	printSample(vct, 9999);
+	vct.insert(vct.begin() + 10, 50000, -1);
+	vct.insert(vct.begin(), vct.begin() + 100, vct.begin() + 120);
+	printSample(vct, 14999);
+	vct.reserve(vct.size() * 3);
+	vct.resize(vct.size() + 1000, 7);
+	vct.erase(vct.begin() + 5, vct.begin() + 60000);
+	printSample(vct, 9999);
+
+	T_VCT	cpy(vct);
+
+	cpy.push_back(42);
+	std::cout << "copy: " << (cpy.size() == vct.size() + 1) << " " << cpy.back() << std::endl;
+	vct.clear();
+	vct.push_back(3);
+	printSize(vct);
+}
+
+int		main(void)
+{
+	grow<TESTED_NAMESPACE::vector<int, MALLOC_ALLOC<int> > >();
+	grow<TESTED_NAMESPACE::vector<int, MMAP_ALLOC<int> > >();
+
+	TESTED_NAMESPACE::vector<std::string, MALLOC_ALLOC<std::string> >	strs;
+
+	for (int i = 0; i < 500; ++i)
+		strs.push_back(std::string(i % 30 + 1, 'a' + i % 26));
+	strs.insert(strs.begin() + 3, 2, "inserted");
+	strs.erase(strs.begin() + 10, strs.begin() + 490);
+	printSize(strs);
+	return (0);
+}
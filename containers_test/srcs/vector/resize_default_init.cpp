@@ -0,0 +1,57 @@
+#include "common.hpp"
+
+//resize_default_init is an ft extension: new int elements are left
+//unwritten, so the test writes them before reading. std::vector
+//value-initializes them, which gives the same class type elements
+#if !defined(USING_STD)
+template <typename T_VCT>
+void	resizeDefaultInit(T_VCT &vct, size_t n)
+{ vct.resize_default_init(n); }
+#else
+template <typename T_VCT>
+void	resizeDefaultInit(T_VCT &vct, size_t n)
+{ vct.resize(n); }
+#endif
+
+int		main(void)
+{
+	TESTED_NAMESPACE::vector<int>	buf(5, 9);
+
+	//Grows like resize(), keeps the old elements
+	resizeDefaultInit(buf, 1 << 20);
+	std::cout << "size: " << buf.size() << " | kept: "
+		<< (buf[0] == 9 && buf[4] == 9) << std::endl;
+	for (size_t i = 5; i < buf.size(); ++i)
+		buf[i] = static_cast<int>(i % 251);
+
+	long	sum = 0;
+
+	for (size_t i = 0; i < buf.size(); ++i)
+		sum += buf[i];
+	std::cout << "sum: " << sum << std::endl;
+
+	//Shrinks like resize(), within the capacity it does not reallocate
+	resizeDefaultInit(buf, 10);
+	printSize(buf);
+
+	const int	*data = &buf[0];
+
+	resizeDefaultInit(buf, 20);
+	std::cout << "same block: " << (data == &buf[0]) << std::endl;
+	for (size_t i = 10; i < 20; ++i)
+		buf[i] = -static_cast<int>(i);
+	printSize(buf);
+	resizeDefaultInit(buf, 20);
+	resizeDefaultInit(buf, 0);
+	printSize(buf);
+
+	//Class types are default constructed
+	TESTED_NAMESPACE::vector<std::string>	strs(2, "kept");
+
+	resizeDefaultInit(strs, 6);
+	strs[4] = "written";
+	printSize(strs);
+	resizeDefaultInit(strs, 3);
+	printSize(strs);
+	return (0);
+}
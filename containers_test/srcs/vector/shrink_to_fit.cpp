@@ -0,0 +1,65 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "ft_realloc_allocator.hpp"
+# define MALLOC_ALLOC ft::malloc_allocator
+#else
+# define MALLOC_ALLOC std::allocator
+#endif
+
+//shrink_to_fit() is C++11: the std side uses the swap trick, which also
+//leaves capacity() == size()
+#if !defined(USING_STD)
+template <typename T_VCT>
+void	shrinkToFit(T_VCT &vct)
+{ vct.shrink_to_fit(); }
+#else
+template <typename T_VCT>
+void	shrinkToFit(T_VCT &vct)
+{ T_VCT(vct).swap(vct); }
+#endif
+
+template <typename T_VCT>
+void	printFit(T_VCT const &vct)
+{
+	std::cout << "capacity == size: " << (vct.capacity() == vct.size()) << std::endl;
+	printSize(vct);
+}
+
+template <typename T_VCT>
+void	trim(const typename T_VCT::value_type &a, const typename T_VCT::value_type &b)
+{
+	T_VCT	vct;
+
+	vct.reserve(100);
+	for (int i = 0; i < 10; ++i)
+		vct.push_back(i % 3 ? a : b);
+	shrinkToFit(vct);
+	printFit(vct);
+
+	//After a burst
+	for (int i = 0; i < 1000; ++i)
+		vct.push_back(a);
+	vct.erase(vct.begin() + 5, vct.end() - 2);
+	shrinkToFit(vct);
+	printFit(vct);
+	shrinkToFit(vct);
+	printFit(vct);
+
+	//Still usable, and empty vectors give their block back
+	vct.push_back(b);
+	vct.insert(vct.begin() + 1, 3, a);
+	printSize(vct);
+	vct.clear();
+	shrinkToFit(vct);
+	std::cout << "empty capacity: " << vct.capacity() << std::endl;
+	vct.push_back(a);
+	printFit(vct);
+}
+
+int		main(void)
+{
+	trim<TESTED_NAMESPACE::vector<int> >(1, 2);
+	trim<TESTED_NAMESPACE::vector<std::string> >("short", std::string(40, 'L'));
+	trim<TESTED_NAMESPACE::vector<int, MALLOC_ALLOC<int> > >(3, 4);
+	return (0);
+}
@@ -0,0 +1,85 @@
+#include "common.hpp"
+
+//int and Point are moved with memmove/memcpy by ft::vector, std::string
+//element by element: the same edits must leave the same elements
+struct Point
+{
+	int		x;
+	short	y;
+};
+
+bool	operator==(const Point &a, const Point &b)
+{ return (a.x == b.x && a.y == b.y); }
+
+std::ostream	&operator<<(std::ostream &o, const Point &p)
+{ return (o << "(" << p.x << ", " << p.y << ")"); }
+
+static int			make(int i, int)
+{ return (i); }
+
+static Point		make(int i, Point)
+{
+	Point p = {i, static_cast<short>(-i)};
+
+	return (p);
+}
+
+static std::string	make(int i, std::string)
+{ return (std::string(i % 5 + 20, 'a' + i % 26)); }
+
+template <typename T>
+void	edit(void)
+{
+	typedef TESTED_NAMESPACE::vector<T>	t_vct;
+	t_vct	vct;
+
+	for (int i = 0; i < 20; ++i)
+		vct.push_back(make(i, T()));
+
+	//Middle inserts shift the tail right
+	vct.insert(vct.begin() + 5, make(100, T()));
+	vct.insert(vct.begin() + 3, 4, make(200, T()));
+	vct.insert(vct.begin() + 10, vct[0]);
+	vct.insert(vct.begin() + 1, 2, vct.back());
+
+	t_vct	src;
+
+	for (int i = 300; i < 306; ++i)
+		src.push_back(make(i, T()));
+	vct.insert(vct.begin() + 7, src.begin(), src.end());
+	vct.insert(vct.end() - 2, src.begin(), src.begin() + 2);
+	printSize(vct);
+
+	//Middle erases shift it left
+	vct.erase(vct.begin() + 4);
+	vct.erase(vct.begin() + 2, vct.begin() + 9);
+	vct.erase(vct.end() - 3, vct.end());
+	vct.erase(vct.begin(), vct.begin());
+	printSize(vct);
+
+	//Inserts past the capacity, copies and assignments
+	vct.insert(vct.begin() + 1, 40, make(400, T()));
+	t_vct	cpy(vct);
+
+	cpy.erase(cpy.begin() + 1, cpy.begin() + 41);
+	std::cout << "copy equal: " << (cpy == vct) << " | " << cpy.size() << std::endl;
+	cpy = src;
+	std::cout << "assigned equal: " << (cpy == src) << std::endl;
+	cpy.assign(vct.begin() + 30, vct.end());
+	printSize(cpy);
+	cpy.assign(3, make(500, T()));
+	printSize(cpy);
+	cpy.assign(50, make(600, T()));
+	cpy[3] = make(700, T());
+	cpy.assign(80, cpy[3]);
+	printSize(cpy, false);
+	std::cout << "front: " << cpy.front() << " | back: " << cpy.back() << std::endl;
+}
+
+int		main(void)
+{
+	edit<int>();
+	edit<Point>();
+	edit<std::string>();
+	return (0);
+}
@@ -0,0 +1,831 @@
+#ifndef DEQUE_HPP
+# define DEQUE_HPP
+
+# include <algorithm>
+# include <cstddef>
+# include <memory>
+# include <sstream>
+# include <stdexcept>
+# include "ft_iterator.hpp"
+# include "ft_utilities.hpp"
+
+//Target size of a chunk in bytes, chunks always hold at least 16 elements
+# ifndef FT_DEQUE_CHUNK_BYTES
+#  define FT_DEQUE_CHUNK_BYTES 4096
+# endif
+
+namespace ft
+{
+	//Number of elements per chunk
+	template<typename T>
+	struct Deque_chunk
+	{
+		enum { size = (sizeof(T) <= FT_DEQUE_CHUNK_BYTES / 16 ? FT_DEQUE_CHUNK_BYTES / sizeof(T) : 16) };
+	};
+
+	//ITERATOR OVER THE CHUNKS: the element, the bounds of its chunk and the
+	//slot of that chunk in the map
+	template<typename T, typename Ref, typename Ptr>
+	struct Deque_iterator
+	{
+		typedef std::random_access_iterator_tag				iterator_category;
+		typedef T											value_type;
+		typedef ptrdiff_t									difference_type;
+		typedef Ptr											pointer;
+		typedef Ref											reference;
+		typedef Deque_iterator<T, T&, T*>					iterator;
+		typedef Deque_iterator<T, const T&, const T*>		const_iterator;
+		typedef T											**map_pointer;
+
+		T			*cur;
+		T			*first;
+		T			*last;
+		map_pointer	node;
+
+		static difference_type	chunk_size()
+		{ return (Deque_chunk<T>::size); }
+
+		Deque_iterator() : cur(0), first(0), last(0), node(0) {}
+
+		Deque_iterator(T *x, map_pointer y)
+			: cur(x), first(*y), last(*y + chunk_size()), node(y) {}
+
+		//iterator to const_iterator
+		Deque_iterator(const iterator &x)
+			: cur(x.cur), first(x.first), last(x.last), node(x.node) {}
+
+		void	set_node(map_pointer new_node)
+		{
+			node = new_node;
+			first = *new_node;
+			last = first + chunk_size();
+		}
+
+		reference	operator*() const
+		{ return (*cur); }
+
+		pointer	operator->() const
+		{ return (cur); }
+
+		Deque_iterator	&operator++()
+		{
+			if (++cur == last)
+			{
+				set_node(node + 1);
+				cur = first;
+			}
+			return (*this);
+		}
+
+		Deque_iterator	operator++(int)
+		{
+			Deque_iterator	tmp(*this);
+
+			++*this;
+			return (tmp);
+		}
+
+		Deque_iterator	&operator--()
+		{
+			if (cur == first)
+			{
+				set_node(node - 1);
+				cur = last;
+			}
+			--cur;
+			return (*this);
+		}
+
+		Deque_iterator	operator--(int)
+		{
+			Deque_iterator	tmp(*this);
+
+			--*this;
+			return (tmp);
+		}
+
+		Deque_iterator	&operator+=(difference_type n)
+		{
+			const difference_type	offset = n + (cur - first);
+
+			if (offset >= 0 && offset < chunk_size())
+				cur += n;
+			else
+			{
+				const difference_type	node_offset = (offset > 0 ? offset / chunk_size()
+					: -((-offset - 1) / chunk_size()) - 1);
+
+				set_node(node + node_offset);
+				cur = first + (offset - node_offset * chunk_size());
+			}
+			return (*this);
+		}
+
+		Deque_iterator	operator+(difference_type n) const
+		{
+			Deque_iterator	tmp(*this);
+
+			return (tmp += n);
+		}
+
+		Deque_iterator	&operator-=(difference_type n)
+		{ return (*this += -n); }
+
+		Deque_iterator	operator-(difference_type n) const
+		{
+			Deque_iterator	tmp(*this);
+
+			return (tmp -= n);
+		}
+
+		reference	operator[](difference_type n) const
+		{ return (*(*this + n)); }
+	};
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline ptrdiff_t	operator-(const Deque_iterator<T, RefL, PtrL> &x, const Deque_iterator<T, RefR, PtrR> &y)
+	{
+		return (Deque_iterator<T, RefL, PtrL>::chunk_size() * (x.node - y.node)
+			+ (x.cur - x.first) - (y.cur - y.first));
+	}
+
+	template<typename T, typename Ref, typename Ptr>
+	inline Deque_iterator<T, Ref, Ptr>	operator+(ptrdiff_t n, const Deque_iterator<T, Ref, Ptr> &x)
+	{ return (x + n); }
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline bool	operator==(const Deque_iterator<T, RefL, PtrL> &x, const Deque_iterator<T, RefR, PtrR> &y)
+	{ return (x.cur == y.cur); }
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline bool	operator!=(const Deque_iterator<T, RefL, PtrL> &x, const Deque_iterator<T, RefR, PtrR> &y)
+	{ return (x.cur != y.cur); }
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline bool	operator<(const Deque_iterator<T, RefL, PtrL> &x, const Deque_iterator<T, RefR, PtrR> &y)
+	{ return (x.node == y.node ? x.cur < y.cur : x.node < y.node); }
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline bool	operator>(const Deque_iterator<T, RefL, PtrL> &x, const Deque_iterator<T, RefR, PtrR> &y)
+	{ return (y < x); }
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline bool	operator<=(const Deque_iterator<T, RefL, PtrL> &x, const Deque_iterator<T, RefR, PtrR> &y)
+	{ return (!(y < x)); }
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline bool	operator>=(const Deque_iterator<T, RefL, PtrL> &x, const Deque_iterator<T, RefR, PtrR> &y)
+	{ return (!(x < y)); }
+
+	//Double ended queue: elements live in fixed size chunks whose addresses
+	//are kept, in order, in the middle of a map. Pushing or popping at either
+	//end never moves an element (only the map is reallocated), so references
+	//stay valid; insert and erase elsewhere shift the shorter side.
+	//One emptied chunk is kept aside so a deque oscillating around a chunk
+	//boundary does not hit the allocator
+	template<typename T, typename Alloc = std::allocator<T> >
+	class deque
+	{
+		public:
+			typedef T											value_type;
+			typedef Alloc										allocator_type;
+			typedef typename Alloc::reference					reference;
+			typedef typename Alloc::const_reference				const_reference;
+			typedef typename Alloc::pointer						pointer;
+			typedef typename Alloc::const_pointer				const_pointer;
+			typedef Deque_iterator<T, T&, T*>					iterator;
+			typedef Deque_iterator<T, const T&, const T*>		const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef ptrdiff_t									difference_type;
+			typedef size_t										size_type;
+
+		private:
+			typedef typename Alloc::template rebind<T>::other	Chunk_alloc;
+			typedef typename Alloc::template rebind<T*>::other	Map_alloc;
+			typedef T											**map_pointer;
+
+			enum { initial_map_size = 8 };
+
+			Chunk_alloc	_alloc;
+			map_pointer	_map;
+			size_type	_map_size;
+			iterator	_start;
+			iterator	_finish;
+			T			*_spare;
+
+			static size_type	_chunk_size()
+			{ return (Deque_chunk<T>::size); }
+
+			//////////////////////CHUNKS AND MAP//////////////////
+			T	*_allocate_chunk()
+			{
+				T	*chunk = _spare;
+
+				if (chunk == 0)
+					return (_alloc.allocate(_chunk_size()));
+				_spare = 0;
+				return (chunk);
+			}
+
+			void	_deallocate_chunk(T *chunk)
+			{
+				if (_spare == 0)
+					_spare = chunk;
+				else
+					_alloc.deallocate(chunk, _chunk_size());
+			}
+
+			void	_destroy(iterator first, iterator last)
+			{
+				for (; first != last; ++first)
+					_alloc.destroy(first.cur);
+			}
+
+			//Destroys the elements and frees every chunk and the map
+			void	_release()
+			{
+				clear();
+				_alloc.deallocate(_start.first, _chunk_size());
+				if (_spare)
+					_alloc.deallocate(_spare, _chunk_size());
+				Map_alloc(_alloc).deallocate(_map, _map_size);
+			}
+
+			//Map and chunks for n elements, the used nodes centered in the map
+			void	_initialize_map(size_type n)
+			{
+				const size_type	nodes = n / _chunk_size() + 1;
+				map_pointer		nstart;
+				map_pointer		cur;
+
+				_map_size = std::max(size_type(initial_map_size), nodes + 2);
+				_map = Map_alloc(_alloc).allocate(_map_size);
+				nstart = _map + (_map_size - nodes) / 2;
+				cur = nstart;
+				try
+				{
+					for (; cur < nstart + nodes; ++cur)
+						*cur = _alloc.allocate(_chunk_size());
+				}
+				catch (...)
+				{
+					while (cur != nstart)
+						_alloc.deallocate(*--cur, _chunk_size());
+					Map_alloc(_alloc).deallocate(_map, _map_size);
+					_map = 0;
+					throw;
+				}
+				_start.set_node(nstart);
+				_start.cur = _start.first;
+				_finish.set_node(nstart + nodes - 1);
+				_finish.cur = _finish.first + n % _chunk_size();
+			}
+
+			//Recenters the used nodes, or moves them to a bigger map, so that
+			//nodes_to_add free slots exist on the requested side
+			void	_reallocate_map(size_type nodes_to_add, bool add_at_front)
+			{
+				const size_type	old_nodes = _finish.node - _start.node + 1;
+				const size_type	new_nodes = old_nodes + nodes_to_add;
+				map_pointer		nstart;
+
+				if (_map_size > 2 * new_nodes)
+				{
+					nstart = _map + (_map_size - new_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
+					if (nstart < _start.node)
+						std::copy(_start.node, _finish.node + 1, nstart);
+					else
+						std::copy_backward(_start.node, _finish.node + 1, nstart + old_nodes);
+				}
+				else
+				{
+					const size_type	new_map_size = _map_size + std::max(_map_size, nodes_to_add) + 2;
+					map_pointer		new_map = Map_alloc(_alloc).allocate(new_map_size);
+
+					nstart = new_map + (new_map_size - new_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
+					std::copy(_start.node, _finish.node + 1, nstart);
+					Map_alloc(_alloc).deallocate(_map, _map_size);
+					_map = new_map;
+					_map_size = new_map_size;
+				}
+				_start.set_node(nstart);
+				_finish.set_node(nstart + old_nodes - 1);
+			}
+
+			void	_reserve_map_at_back(size_type nodes_to_add = 1)
+			{
+				if (nodes_to_add + 1 > _map_size - (_finish.node - _map))
+					_reallocate_map(nodes_to_add, false);
+			}
+
+			void	_reserve_map_at_front(size_type nodes_to_add = 1)
+			{
+				if (nodes_to_add > size_type(_start.node - _map))
+					_reallocate_map(nodes_to_add, true);
+			}
+
+			//Slow paths of push_back / push_front: a new chunk is needed
+			FT_COLD void	_push_back_aux(const value_type &val)
+			{
+				_reserve_map_at_back();
+				*(_finish.node + 1) = _allocate_chunk();
+				try
+				{
+					_alloc.construct(_finish.cur, val);
+				}
+				catch (...)
+				{
+					_deallocate_chunk(*(_finish.node + 1));
+					throw;
+				}
+				_finish.set_node(_finish.node + 1);
+				_finish.cur = _finish.first;
+			}
+
+			FT_COLD void	_push_front_aux(const value_type &val)
+			{
+				_reserve_map_at_front();
+				*(_start.node - 1) = _allocate_chunk();
+				try
+				{
+					_alloc.construct(*(_start.node - 1) + _chunk_size() - 1, val);
+				}
+				catch (...)
+				{
+					_deallocate_chunk(*(_start.node - 1));
+					throw;
+				}
+				_start.set_node(_start.node - 1);
+				_start.cur = _start.last - 1;
+			}
+
+			void	_range_check(size_type n) const
+			{
+				if (n >= size())
+					_throw_out_of_range(n);
+			}
+
+			FT_COLD void	_throw_out_of_range(size_type n) const
+			{
+				std::ostringstream	msg;
+
+				msg << "deque::_M_range_check: __n (which is " << n
+					<< ")>= this->size() (which is " << size() << ")";
+				throw std::out_of_range(msg.str());
+			}
+
+			//Drops n elements at one end
+			void	_erase_at_front(size_type n)
+			{
+				while (n--)
+					pop_front();
+			}
+
+			void	_erase_at_back(size_type n)
+			{
+				while (n--)
+					pop_back();
+			}
+
+			//Appends (or prepends, reversed) [first, last) then rotates the new
+			//elements to index. Pushes are undone if one of them throws
+			template<typename Iterator>
+			void	_insert_range(size_type index, Iterator first, Iterator last)
+			{
+				const size_type	old_size = size();
+
+				if (index < old_size / 2)
+				{
+					try
+					{
+						for (; first != last; ++first)
+							push_front(*first);
+					}
+					catch (...)
+					{
+						_erase_at_front(size() - old_size);
+						throw;
+					}
+					const size_type	n = size() - old_size;
+
+					std::reverse(begin(), begin() + n);
+					std::rotate(begin(), begin() + n, begin() + n + index);
+				}
+				else
+				{
+					try
+					{
+						for (; first != last; ++first)
+							push_back(*first);
+					}
+					catch (...)
+					{
+						_erase_at_back(size() - old_size);
+						throw;
+					}
+					std::rotate(begin() + index, begin() + old_size, end());
+				}
+			}
+
+			void	_fill_insert(size_type index, size_type n, const value_type &val)
+			{
+				const size_type	old_size = size();
+				const value_type	copy(val);
+
+				if (index < old_size / 2)
+				{
+					try
+					{
+						for (size_type i = 0; i < n; ++i)
+							push_front(copy);
+					}
+					catch (...)
+					{
+						_erase_at_front(size() - old_size);
+						throw;
+					}
+					std::rotate(begin(), begin() + n, begin() + n + index);
+				}
+				else
+				{
+					try
+					{
+						for (size_type i = 0; i < n; ++i)
+							push_back(copy);
+					}
+					catch (...)
+					{
+						_erase_at_back(size() - old_size);
+						throw;
+					}
+					std::rotate(begin() + index, begin() + old_size, end());
+				}
+			}
+
+			template<typename Integral>
+			void	_dispatch_insert(iterator position, Integral n, Integral val, true_type)
+			{ _fill_insert(position - begin(), static_cast<size_type>(n), static_cast<value_type>(val)); }
+
+			template<typename Iterator>
+			void	_dispatch_insert(iterator position, Iterator first, Iterator last, false_type)
+			{ _insert_range(position - begin(), first, last); }
+
+			template<typename Integral>
+			void	_dispatch_assign(Integral n, Integral val, true_type)
+			{ assign(static_cast<size_type>(n), static_cast<value_type>(val)); }
+
+			//Assigns over the existing elements, then trims or appends the rest
+			template<typename Iterator>
+			void	_dispatch_assign(Iterator first, Iterator last, false_type)
+			{
+				iterator	cur = begin();
+
+				for (; first != last && cur != end(); ++first, ++cur)
+					*cur = *first;
+				if (first == last)
+					erase(cur, end());
+				else
+					for (; first != last; ++first)
+						push_back(*first);
+			}
+
+		public:
+			//////////////////////CONSTRUCTORS//////////////////
+			explicit deque(const allocator_type &alloc = allocator_type())
+				: _alloc(alloc), _map(0), _map_size(0), _spare(0)
+			{ _initialize_map(0); }
+
+			explicit deque(size_type n, const value_type &val = value_type(),
+				const allocator_type &alloc = allocator_type())
+				: _alloc(alloc), _map(0), _map_size(0), _spare(0)
+			{
+				_initialize_map(0);
+				try
+				{
+					_fill_insert(0, n, val);
+				}
+				catch (...)
+				{
+					_release();
+					throw;
+				}
+			}
+
+			template<typename Iterator>
+			deque(Iterator first, Iterator last, const allocator_type &alloc = allocator_type())
+				: _alloc(alloc), _map(0), _map_size(0), _spare(0)
+			{
+				ft::is_integral<Iterator>	Integral;
+
+				_initialize_map(0);
+				try
+				{
+					_dispatch_insert(end(), first, last, Integral);
+				}
+				catch (...)
+				{
+					_release();
+					throw;
+				}
+			}
+
+			deque(const deque &src)
+				: _alloc(src._alloc), _map(0), _map_size(0), _spare(0)
+			{
+				_initialize_map(0);
+				try
+				{
+					_insert_range(0, src.begin(), src.end());
+				}
+				catch (...)
+				{
+					_release();
+					throw;
+				}
+			}
+
+			~deque()
+			{ _release(); }
+
+			deque	&operator=(const deque &src)
+			{
+				if (this != &src)
+					_dispatch_assign(src.begin(), src.end(), false_type());
+				return (*this);
+			}
+
+			void	assign(size_type n, const value_type &val)
+			{
+				const value_type	copy(val);
+				iterator			cur = begin();
+
+				for (; n && cur != end(); --n, ++cur)
+					*cur = copy;
+				if (n == 0)
+					erase(cur, end());
+				else
+					_fill_insert(size(), n, copy);
+			}
+
+			template<typename Iterator>
+			void	assign(Iterator first, Iterator last)
+			{
+				ft::is_integral<Iterator>	Integral;
+
+				_dispatch_assign(first, last, Integral);
+			}
+
+			allocator_type	get_allocator() const
+			{ return (allocator_type(_alloc)); }
+
+			//////////////////////ITERATORS////////////////////////
+			iterator	begin()
+			{ return (_start); }
+
+			const_iterator	begin() const
+			{ return (_start); }
+
+			iterator	end()
+			{ return (_finish); }
+
+			const_iterator	end() const
+			{ return (_finish); }
+
+			reverse_iterator	rbegin()
+			{ return (reverse_iterator(end())); }
+
+			const_reverse_iterator	rbegin() const
+			{ return (const_reverse_iterator(end())); }
+
+			reverse_iterator	rend()
+			{ return (reverse_iterator(begin())); }
+
+			const_reverse_iterator	rend() const
+			{ return (const_reverse_iterator(begin())); }
+
+			//////////////////////CAPACITY////////////////////////
+			size_type	size() const
+			{ return (_finish - _start); }
+
+			size_type	max_size() const
+			{ return (_alloc.max_size()); }
+
+			bool	empty() const
+			{ return (_finish == _start); }
+
+			void	resize(size_type n, value_type val = value_type())
+			{
+				const size_type	len = size();
+
+				if (n < len)
+					erase(begin() + n, end());
+				else if (n > len)
+					_fill_insert(len, n - len, val);
+			}
+
+			//Frees the spare chunk and fits the map to the used chunks
+			void	shrink_to_fit()
+			{
+				const size_type	nodes = _finish.node - _start.node + 1;
+
+				if (_spare)
+					_alloc.deallocate(_spare, _chunk_size());
+				_spare = 0;
+				if (_map_size > std::max(size_type(initial_map_size), nodes + 2))
+				{
+					const size_type	new_map_size = std::max(size_type(initial_map_size), nodes + 2);
+					map_pointer		new_map = Map_alloc(_alloc).allocate(new_map_size);
+					map_pointer		nstart = new_map + (new_map_size - nodes) / 2;
+
+					std::copy(_start.node, _finish.node + 1, nstart);
+					Map_alloc(_alloc).deallocate(_map, _map_size);
+					_map = new_map;
+					_map_size = new_map_size;
+					_start.set_node(nstart);
+					_finish.set_node(nstart + nodes - 1);
+				}
+			}
+
+			//////////////////////ELEMENT_ACCESS////////////////////////
+			reference	operator[](size_type n)
+			{ return (_start[difference_type(n)]); }
+
+			const_reference	operator[](size_type n) const
+			{ return (_start[difference_type(n)]); }
+
+			reference	at(size_type n)
+			{
+				_range_check(n);
+				return ((*this)[n]);
+			}
+
+			const_reference	at(size_type n) const
+			{
+				_range_check(n);
+				return ((*this)[n]);
+			}
+
+			reference	front()
+			{ return (*_start); }
+
+			const_reference	front() const
+			{ return (*_start); }
+
+			reference	back()
+			{ return (*(_finish - 1)); }
+
+			const_reference	back() const
+			{ return (*(_finish - 1)); }
+
+			//////////////////////MODIFIERS////////////////////////
+			void	push_back(const value_type &val)
+			{
+				if (_finish.cur != _finish.last - 1)
+				{
+					_alloc.construct(_finish.cur, val);
+					++_finish.cur;
+				}
+				else
+					_push_back_aux(val);
+			}
+
+			void	push_front(const value_type &val)
+			{
+				if (_start.cur != _start.first)
+				{
+					_alloc.construct(_start.cur - 1, val);
+					--_start.cur;
+				}
+				else
+					_push_front_aux(val);
+			}
+
+			void	pop_back()
+			{
+				if (_finish.cur == _finish.first)
+				{
+					_deallocate_chunk(_finish.first);
+					_finish.set_node(_finish.node - 1);
+					_finish.cur = _finish.last;
+				}
+				--_finish.cur;
+				_alloc.destroy(_finish.cur);
+			}
+
+			void	pop_front()
+			{
+				_alloc.destroy(_start.cur);
+				if (_start.cur == _start.last - 1)
+				{
+					_deallocate_chunk(_start.first);
+					_start.set_node(_start.node + 1);
+					_start.cur = _start.first;
+				}
+				else
+					++_start.cur;
+			}
+
+			iterator	insert(iterator position, const value_type &val)
+			{
+				const size_type	index = position - begin();
+
+				if (index == 0)
+				{
+					push_front(val);
+					return (begin());
+				}
+				if (index == size())
+				{
+					push_back(val);
+					return (end() - 1);
+				}
+				_fill_insert(index, 1, val);
+				return (begin() + index);
+			}
+
+			void	insert(iterator position, size_type n, const value_type &val)
+			{ _fill_insert(position - begin(), n, val); }
+
+			template<typename Iterator>
+			void	insert(iterator position, Iterator first, Iterator last)
+			{
+				ft::is_integral<Iterator>	Integral;
+
+				_dispatch_insert(position, first, last, Integral);
+			}
+
+			iterator	erase(iterator position)
+			{ return (erase(position, position + 1)); }
+
+			//Shifts the shorter side over the hole, then pops the leftovers
+			iterator	erase(iterator first, iterator last)
+			{
+				const size_type	n = last - first;
+				const size_type	before = first - begin();
+
+				if (n == 0)
+					return (first);
+				if (before < (size() - n) / 2)
+				{
+					std::copy_backward(begin(), first, last);
+					_erase_at_front(n);
+				}
+				else
+				{
+					std::copy(last, end(), first);
+					_erase_at_back(n);
+				}
+				return (begin() + before);
+			}
+
+			void	swap(deque &x)
+			{
+				std::swap(_map, x._map);
+				std::swap(_map_size, x._map_size);
+				std::swap(_start, x._start);
+				std::swap(_finish, x._finish);
+				std::swap(_spare, x._spare);
+				std::swap(_alloc, x._alloc);
+			}
+
+			//Keeps the chunk of begin(), frees the others
+			void	clear()
+			{
+				_destroy(_start, _finish);
+				for (map_pointer node = _start.node + 1; node <= _finish.node; ++node)
+					_deallocate_chunk(*node);
+				_finish = _start;
+			}
+	};
+
+	template<typename T, typename Alloc>
+	inline bool	operator==(const deque<T, Alloc> &x, const deque<T, Alloc> &y)
+	{ return (x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin())); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator!=(const deque<T, Alloc> &x, const deque<T, Alloc> &y)
+	{ return (!(x == y)); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator<(const deque<T, Alloc> &x, const deque<T, Alloc> &y)
+	{ return (ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end())); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator>(const deque<T, Alloc> &x, const deque<T, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator<=(const deque<T, Alloc> &x, const deque<T, Alloc> &y)
+	{ return (!(y < x)); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator>=(const deque<T, Alloc> &x, const deque<T, Alloc> &y)
+	{ return (!(x < y)); }
+
+	template<typename T, typename Alloc>
+	inline void	swap(deque<T, Alloc> &x, deque<T, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
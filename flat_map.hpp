@@ -0,0 +1,572 @@
+#ifndef FLAT_MAP_HPP
+# define FLAT_MAP_HPP
+
+# include <algorithm>
+# include <functional>
+# include <iterator>
+# include <memory>
+# include "ft_iterator.hpp"
+# include "ft_pair.hpp"
+# include "ft_utilities.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	//Keys and mapped values live in two parallel vectors, so dereferencing
+	//yields a proxy holding references to both halves instead of a real pair
+	template<typename Key, typename T>
+	struct Flat_map_pointer;
+
+	template<typename Key, typename T>
+	struct Flat_map_reference
+	{
+		const Key	&first;
+		T			&second;
+
+		Flat_map_reference(const Key &k, T &v) : first(k), second(v) {}
+
+		template<typename U>
+		Flat_map_reference(const Flat_map_reference<Key, U> &src) : first(src.first), second(src.second) {}
+
+		template<typename K, typename V>
+		operator ft::pair<K, V>() const
+		{ return ft::pair<K, V>(first, second); }
+
+		//Lets reverse_iterator::operator-> take the address of a proxy
+		Flat_map_pointer<Key, T>	operator&() const
+		{ return Flat_map_pointer<Key, T>(*this); }
+
+		private:
+			Flat_map_reference	&operator=(const Flat_map_reference &);
+	};
+
+	template<typename Key, typename T>
+	struct Flat_map_pointer
+	{
+		Flat_map_reference<Key, T>	ref;
+
+		explicit Flat_map_pointer(const Flat_map_reference<Key, T> &r) : ref(r) {}
+
+		//operator& is overloaded on the proxy, take its real address
+		const Flat_map_reference<Key, T>	*operator->() const
+		{ return reinterpret_cast<const Flat_map_reference<Key, T>*>(&reinterpret_cast<const char&>(ref)); }
+	};
+
+	template<typename Key, typename T, typename Mapped>
+	class Flat_map_iterator
+	{
+		template<typename K, typename V, typename M>
+		friend class Flat_map_iterator;
+
+		public:
+			typedef std::random_access_iterator_tag	iterator_category;
+			typedef ft::pair<const Key, T>			value_type;
+			typedef ptrdiff_t						difference_type;
+			typedef Flat_map_reference<Key, Mapped>	reference;
+			typedef Flat_map_pointer<Key, Mapped>	pointer;
+
+		private:
+			const Key	*_key;
+			Mapped		*_value;
+
+		public:
+			Flat_map_iterator() : _key(0), _value(0) {}
+
+			Flat_map_iterator(const Key *k, Mapped *v) : _key(k), _value(v) {}
+
+			// Allow iterator to const_iterator conversion
+			Flat_map_iterator(const Flat_map_iterator<Key, T, T> &src) : _key(src._key), _value(src._value) {}
+
+			const Key	*key_base() const
+			{ return _key; }
+
+			reference	operator*() const
+			{ return reference(*_key, *_value); }
+
+			pointer	operator->() const
+			{ return pointer(**this); }
+
+			reference	operator[](difference_type n) const
+			{ return reference(_key[n], _value[n]); }
+
+			Flat_map_iterator	&operator++()
+			{
+				++_key;
+				++_value;
+				return (*this);
+			}
+
+			Flat_map_iterator	operator++(int)
+			{
+				Flat_map_iterator tmp = *this;
+				++*this;
+				return (tmp);
+			}
+
+			Flat_map_iterator	&operator--()
+			{
+				--_key;
+				--_value;
+				return (*this);
+			}
+
+			Flat_map_iterator	operator--(int)
+			{
+				Flat_map_iterator tmp = *this;
+				--*this;
+				return (tmp);
+			}
+
+			Flat_map_iterator	&operator+=(difference_type n)
+			{
+				_key += n;
+				_value += n;
+				return (*this);
+			}
+
+			Flat_map_iterator	&operator-=(difference_type n)
+			{ return (*this += -n); }
+
+			Flat_map_iterator	operator+(difference_type n) const
+			{ return Flat_map_iterator(_key + n, _value + n); }
+
+			Flat_map_iterator	operator-(difference_type n) const
+			{ return Flat_map_iterator(_key - n, _value - n); }
+	};
+
+	template<typename K, typename T, typename ML, typename MR>
+	inline ptrdiff_t	operator-(const Flat_map_iterator<K, T, ML> &x, const Flat_map_iterator<K, T, MR> &y)
+	{ return x.key_base() - y.key_base(); }
+
+	template<typename K, typename T, typename ML, typename MR>
+	inline bool	operator==(const Flat_map_iterator<K, T, ML> &x, const Flat_map_iterator<K, T, MR> &y)
+	{ return x.key_base() == y.key_base(); }
+
+	template<typename K, typename T, typename ML, typename MR>
+	inline bool	operator!=(const Flat_map_iterator<K, T, ML> &x, const Flat_map_iterator<K, T, MR> &y)
+	{ return x.key_base() != y.key_base(); }
+
+	template<typename K, typename T, typename ML, typename MR>
+	inline bool	operator<(const Flat_map_iterator<K, T, ML> &x, const Flat_map_iterator<K, T, MR> &y)
+	{ return x.key_base() < y.key_base(); }
+
+	template<typename K, typename T, typename ML, typename MR>
+	inline bool	operator>(const Flat_map_iterator<K, T, ML> &x, const Flat_map_iterator<K, T, MR> &y)
+	{ return x.key_base() > y.key_base(); }
+
+	template<typename K, typename T, typename ML, typename MR>
+	inline bool	operator<=(const Flat_map_iterator<K, T, ML> &x, const Flat_map_iterator<K, T, MR> &y)
+	{ return x.key_base() <= y.key_base(); }
+
+	template<typename K, typename T, typename ML, typename MR>
+	inline bool	operator>=(const Flat_map_iterator<K, T, ML> &x, const Flat_map_iterator<K, T, MR> &y)
+	{ return x.key_base() >= y.key_base(); }
+
+	template<typename K, typename T, typename M>
+	inline Flat_map_iterator<K, T, M>	operator+(ptrdiff_t n, const Flat_map_iterator<K, T, M> &x)
+	{ return x + n; }
+
+	//Sorted associative container with the map interface, stored in two
+	//ft::vector (keys, mapped values): lookups binary search a dense key
+	//array. Insertion and erasure are O(n) and invalidate iterators, range
+	//insertion sorts the new elements and merges them in one O(n + m log m) pass
+	template
+	<
+		typename Key,
+		typename T,
+		typename Compare = std::less<Key>,
+		typename Alloc = std::allocator<ft::pair <const Key, T> >
+	>
+	class flat_map
+	{
+		public:
+			typedef Key								key_type;
+			typedef T								mapped_type;
+			typedef ft::pair<const Key, T>			value_type;
+			typedef Compare							key_compare;
+			typedef Alloc							allocator_type;
+
+			typedef Flat_map_reference<Key, T>			reference;
+			typedef Flat_map_reference<Key, const T>	const_reference;
+			typedef Flat_map_pointer<Key, T>			pointer;
+			typedef Flat_map_pointer<Key, const T>		const_pointer;
+
+			typedef Flat_map_iterator<Key, T, T>				iterator;
+			typedef Flat_map_iterator<Key, T, const T>			const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef ptrdiff_t									difference_type;
+			typedef size_t										size_type;
+
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				friend class flat_map<Key, T, Compare, Alloc>;
+
+				protected:
+					Compare	comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					bool	operator()(const value_type &x, const value_type &y) const
+					{ return comp(x.first, y.first); }
+			};
+
+		private:
+			typedef typename Alloc::template rebind<Key>::other		key_allocator;
+			typedef typename Alloc::template rebind<T>::other		mapped_allocator;
+			typedef ft::vector<Key, key_allocator>					key_container;
+			typedef ft::vector<T, mapped_allocator>					mapped_container;
+			typedef ft::pair<Key, T>								staged_type;
+			typedef typename Alloc::template rebind<staged_type>::other	staged_allocator;
+
+			struct Staged_compare
+			{
+				Compare	comp;
+
+				Staged_compare(const Compare &c) : comp(c) {}
+
+				bool	operator()(const staged_type &x, const staged_type &y) const
+				{ return comp(x.first, y.first); }
+			};
+
+			key_compare			_comp;
+			key_container		_keys;
+			mapped_container	_values;
+
+			const Key	*_key_data() const
+			{ return (_keys.empty() ? 0 : &_keys[0]); }
+
+			size_type	_lower_index(const key_type &k) const
+			{ return (branchless_lower_bound(_key_data(), _keys.size(), k, _comp) - _key_data()); }
+
+			size_type	_upper_index(const key_type &k) const
+			{
+				size_type i = _lower_index(k);
+
+				return ((i != size() && !_comp(k, _keys[i])) ? i + 1 : i);
+			}
+
+			bool	_found(size_type i, const key_type &k) const
+			{ return (i != size() && !_comp(k, _keys[i])); }
+
+			iterator	_it(size_type i)
+			{ return (iterator(_key_data() + i, _values.empty() ? 0 : &_values[0] + i)); }
+
+			const_iterator	_it(size_type i) const
+			{ return (const_iterator(_key_data() + i, _values.empty() ? 0 : &_values[0] + i)); }
+
+			iterator	_insert_at(size_type i, const key_type &k, const mapped_type &v)
+			{
+				_keys.insert(_keys.begin() + i, k);
+				try
+				{ _values.insert(_values.begin() + i, v); }
+				catch (...)
+				{
+					_keys.erase(_keys.begin() + i);
+					throw;
+				}
+				return (_it(i));
+			}
+
+			//Sorts the batch, keeps the first of equal keys and those not
+			//already present, then merges both sorted runs into new storage
+			void	_merge(ft::vector<staged_type, staged_allocator> &staged)
+			{
+				size_type	n = 0;
+
+				std::stable_sort(staged.begin(), staged.end(), Staged_compare(_comp));
+				for (size_type j = 0; j < staged.size(); ++j)
+				{
+					if (n != 0 && !_comp(staged[n - 1].first, staged[j].first))
+						continue ;
+					if (_found(_lower_index(staged[j].first), staged[j].first))
+						continue ;
+					if (n != j)
+						staged[n] = staged[j];
+					++n;
+				}
+				if (n == 0)
+					return ;
+
+				key_container		keys(_keys.get_allocator());
+				mapped_container	values(_values.get_allocator());
+				size_type			i = 0;
+				size_type			j = 0;
+
+				keys.reserve(size() + n);
+				values.reserve(size() + n);
+				while (i < size() || j < n)
+				{
+					if (j == n || (i < size() && _comp(_keys[i], staged[j].first)))
+					{
+						keys.push_back(_keys[i]);
+						values.push_back(_values[i++]);
+					}
+					else
+					{
+						keys.push_back(staged[j].first);
+						values.push_back(staged[j++].second);
+					}
+				}
+				_keys.swap(keys);
+				_values.swap(values);
+			}
+
+		public:
+			//CONSTRUCTORS, OPERATOR=
+			explicit flat_map(const key_compare &comp = key_compare(),
+				const allocator_type &alloc = allocator_type())
+				: _comp(comp), _keys(key_allocator(alloc)), _values(mapped_allocator(alloc)) {}
+
+			template<typename Iterator>
+			flat_map(Iterator first, Iterator last,
+				const key_compare &comp = key_compare(),
+				const allocator_type &alloc = allocator_type())
+				: _comp(comp), _keys(key_allocator(alloc)), _values(mapped_allocator(alloc))
+			{ insert(first, last); }
+
+			flat_map(const flat_map &src) : _comp(src._comp), _keys(src._keys), _values(src._values) {}
+
+			flat_map	&operator=(const flat_map &src)
+			{
+				_comp = src._comp;
+				_keys = src._keys;
+				_values = src._values;
+				return (*this);
+			}
+
+			//ITERATORS
+			iterator	begin()
+			{ return _it(0); }
+
+			const_iterator	begin() const
+			{ return _it(0); }
+
+			iterator	end()
+			{ return _it(size()); }
+
+			const_iterator	end() const
+			{ return _it(size()); }
+
+			reverse_iterator	rbegin()
+			{ return reverse_iterator(end()); }
+
+			const_reverse_iterator	rbegin() const
+			{ return const_reverse_iterator(end()); }
+
+			reverse_iterator	rend()
+			{ return reverse_iterator(begin()); }
+
+			const_reverse_iterator	rend() const
+			{ return const_reverse_iterator(begin()); }
+
+			//CAPACITY
+			bool	empty() const
+			{ return _keys.empty(); }
+
+			size_type	size() const
+			{ return _keys.size(); }
+
+			size_type	max_size() const
+			{ return std::min(_keys.max_size(), _values.max_size()); }
+
+			size_type	capacity() const
+			{ return _keys.capacity(); }
+
+			void	reserve(size_type n)
+			{
+				_keys.reserve(n);
+				_values.reserve(n);
+			}
+
+			void	shrink_to_fit()
+			{
+				_keys.shrink_to_fit();
+				_values.shrink_to_fit();
+			}
+
+			//ELEMENT ACCESS
+			mapped_type	&operator[](const key_type &k)
+			{
+				size_type i = _lower_index(k);
+
+				if (!_found(i, k))
+					_insert_at(i, k, mapped_type());
+				return (_values[i]);
+			}
+
+			//MODIFIERS
+			ft::pair<iterator, bool>	insert(const value_type &val)
+			{
+				size_type i = _lower_index(val.first);
+
+				if (_found(i, val.first))
+					return ft::pair<iterator, bool>(_it(i), false);
+				return ft::pair<iterator, bool>(_insert_at(i, val.first, val.second), true);
+			}
+
+			//The hint is used when it is exactly the insertion point
+			iterator	insert(iterator position, const value_type &val)
+			{
+				size_type i = position - begin();
+
+				if ((i == 0 || _comp(_keys[i - 1], val.first)) && (i == size() || _comp(val.first, _keys[i])))
+					return (_insert_at(i, val.first, val.second));
+				return (insert(val).first);
+			}
+
+			template<typename Iterator>
+			void	insert(Iterator first, Iterator last)
+			{
+				ft::vector<staged_type, staged_allocator>	staged((staged_allocator(_keys.get_allocator())));
+
+				for (; first != last; ++first)
+					staged.push_back(staged_type((*first).first, (*first).second));
+				_merge(staged);
+			}
+
+			void	erase(iterator position)
+			{
+				size_type i = position - begin();
+
+				_keys.erase(_keys.begin() + i);
+				_values.erase(_values.begin() + i);
+			}
+
+			size_type	erase(const key_type &k)
+			{
+				size_type i = _lower_index(k);
+
+				if (!_found(i, k))
+					return (0);
+				erase(_it(i));
+				return (1);
+			}
+
+			void	erase(iterator first, iterator last)
+			{
+				size_type i = first - begin();
+				size_type j = last - begin();
+
+				_keys.erase(_keys.begin() + i, _keys.begin() + j);
+				_values.erase(_values.begin() + i, _values.begin() + j);
+			}
+
+			void	swap(flat_map &x)
+			{
+				std::swap(_comp, x._comp);
+				_keys.swap(x._keys);
+				_values.swap(x._values);
+			}
+
+			void	clear()
+			{
+				_keys.clear();
+				_values.clear();
+			}
+
+			//OBSERVERS
+			key_compare	key_comp() const
+			{ return _comp; }
+
+			value_compare	value_comp() const
+			{ return value_compare(_comp); }
+
+			//OPERATIONS
+			iterator	find(const key_type &k)
+			{
+				size_type i = _lower_index(k);
+
+				return (_found(i, k) ? _it(i) : end());
+			}
+
+			const_iterator	find(const key_type &k) const
+			{
+				size_type i = _lower_index(k);
+
+				return (_found(i, k) ? _it(i) : end());
+			}
+
+			size_type	count(const key_type &k) const
+			{ return (_found(_lower_index(k), k) ? 1 : 0); }
+
+			iterator	lower_bound(const key_type &k)
+			{ return _it(_lower_index(k)); }
+
+			const_iterator	lower_bound(const key_type &k) const
+			{ return _it(_lower_index(k)); }
+
+			iterator	upper_bound(const key_type &k)
+			{ return _it(_upper_index(k)); }
+
+			const_iterator	upper_bound(const key_type &k) const
+			{ return _it(_upper_index(k)); }
+
+			ft::pair<iterator, iterator>	equal_range(const key_type &k)
+			{ return ft::pair<iterator, iterator>(lower_bound(k), upper_bound(k)); }
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+			{ return ft::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)); }
+
+			//ALLOCATOR
+			allocator_type	get_allocator() const
+			{ return allocator_type(_keys.get_allocator()); }
+
+			//Friend prototype to have access to the storage outside
+			template<typename K, typename V, typename C, typename A>
+			friend bool	operator==(const flat_map<K, V, C, A>&, const flat_map<K, V, C, A>&);
+
+			template<typename K, typename V, typename C, typename A>
+			friend bool	operator<(const flat_map<K, V, C, A>&, const flat_map<K, V, C, A>&);
+	};
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator==(const flat_map<Key, Tp, Compare, Alloc> &x,
+		const flat_map<Key, Tp, Compare, Alloc> &y)
+	{ return (x._keys == y._keys && x._values == y._values); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator<(const flat_map<Key, Tp, Compare, Alloc> &x,
+		const flat_map<Key, Tp, Compare, Alloc> &y)
+	{
+		for (size_t i = 0; i < x.size(); ++i)
+		{
+			if (i == y.size())
+				return (false);
+			if (x._keys[i] < y._keys[i])
+				return (true);
+			if (y._keys[i] < x._keys[i])
+				return (false);
+			if (x._values[i] < y._values[i])
+				return (true);
+			if (y._values[i] < x._values[i])
+				return (false);
+		}
+		return (x.size() < y.size());
+	}
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator!=(const flat_map<Key, Tp, Compare, Alloc> &x,
+		const flat_map<Key, Tp, Compare, Alloc> &y)
+	{ return !(x == y); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator>(const flat_map<Key, Tp, Compare, Alloc> &x,
+		const flat_map<Key, Tp, Compare, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator<=(const flat_map<Key, Tp, Compare, Alloc> &x,
+		const flat_map<Key, Tp, Compare, Alloc> &y)
+	{ return !(y < x); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator>=(const flat_map<Key, Tp, Compare, Alloc> &x,
+		const flat_map<Key, Tp, Compare, Alloc> &y)
+	{ return !(x < y); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline void swap(flat_map<Key, Tp, Compare, Alloc> &x, flat_map<Key, Tp, Compare, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
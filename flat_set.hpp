@@ -0,0 +1,286 @@
+#ifndef FLAT_SET_HPP
+# define FLAT_SET_HPP
+
+# include <algorithm>
+# include <functional>
+# include <memory>
+# include "ft_iterator.hpp"
+# include "ft_pair.hpp"
+# include "ft_utilities.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	//Sorted associative container with the set interface, stored in a single
+	//ft::vector: lookups binary search a dense array. Insertion and erasure
+	//are O(n) and invalidate iterators, range insertion sorts the new
+	//elements and merges them in one O(n + m log m) pass
+	template
+	<
+		typename Key,
+		typename Compare = std::less<Key>,
+		typename Alloc = std::allocator<Key>
+	>
+	class flat_set
+	{
+		public:
+			typedef Key		key_type;
+			typedef Key		value_type;
+			typedef Compare	key_compare;
+			typedef	Compare	value_compare;
+			typedef Alloc	allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef ft::vector<Key, Alloc>	container_type;
+
+			key_compare		_comp;
+			container_type	_keys;
+
+			const Key	*_data() const
+			{ return (_keys.empty() ? 0 : &_keys[0]); }
+
+			size_t	_lower_index(const key_type &k) const
+			{ return (branchless_lower_bound(_data(), _keys.size(), k, _comp) - _data()); }
+
+			bool	_found(size_t i, const key_type &k) const
+			{ return (i != _keys.size() && !_comp(k, _keys[i])); }
+
+			//Sorts the batch, keeps the first of equal keys and those not
+			//already present, then merges both sorted runs into new storage
+			void	_merge(container_type &staged)
+			{
+				size_t	n = 0;
+
+				std::stable_sort(staged.begin(), staged.end(), _comp);
+				for (size_t j = 0; j < staged.size(); ++j)
+				{
+					if (n != 0 && !_comp(staged[n - 1], staged[j]))
+						continue ;
+					if (_found(_lower_index(staged[j]), staged[j]))
+						continue ;
+					if (n != j)
+						staged[n] = staged[j];
+					++n;
+				}
+				if (n == 0)
+					return ;
+
+				container_type	keys(_keys.get_allocator());
+				size_t			i = 0;
+				size_t			j = 0;
+
+				keys.reserve(_keys.size() + n);
+				while (i < _keys.size() || j < n)
+				{
+					if (j == n || (i < _keys.size() && _comp(_keys[i], staged[j])))
+						keys.push_back(_keys[i++]);
+					else
+						keys.push_back(staged[j++]);
+				}
+				_keys.swap(keys);
+			}
+
+		public:
+			typedef typename container_type::const_iterator					iterator;
+			typedef typename container_type::const_iterator					const_iterator;
+			typedef typename container_type::const_reverse_iterator			reverse_iterator;
+			typedef typename container_type::const_reverse_iterator			const_reverse_iterator;
+			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+			typedef size_t													size_type;
+
+			//CONSTRUCTORS, OPERATOR=
+			explicit flat_set(const key_compare &comp = key_compare(),
+				const allocator_type &alloc = allocator_type())
+				: _comp(comp), _keys(alloc) {}
+
+			template<typename Iterator>
+			flat_set(Iterator first, Iterator last,
+				const key_compare &comp = key_compare(),
+				const allocator_type &alloc = allocator_type())
+				: _comp(comp), _keys(alloc)
+			{ insert(first, last); }
+
+			flat_set(const flat_set &src) : _comp(src._comp), _keys(src._keys) {}
+
+			flat_set	&operator=(const flat_set &src)
+			{
+				_comp = src._comp;
+				_keys = src._keys;
+				return (*this);
+			}
+
+			//ITERATORS
+			iterator	begin() const
+			{ return _keys.begin(); }
+
+			iterator	end() const
+			{ return _keys.end(); }
+
+			reverse_iterator	rbegin() const
+			{ return _keys.rbegin(); }
+
+			reverse_iterator	rend() const
+			{ return _keys.rend(); }
+
+			//CAPACITY
+			bool	empty() const
+			{ return _keys.empty(); }
+
+			size_type	size() const
+			{ return _keys.size(); }
+
+			size_type	max_size() const
+			{ return _keys.max_size(); }
+
+			size_type	capacity() const
+			{ return _keys.capacity(); }
+
+			void	reserve(size_type n)
+			{ _keys.reserve(n); }
+
+			void	shrink_to_fit()
+			{ _keys.shrink_to_fit(); }
+
+			//MODIFIERS
+			ft::pair<iterator, bool>	insert(const value_type &val)
+			{
+				size_type i = _lower_index(val);
+
+				if (_found(i, val))
+					return ft::pair<iterator, bool>(begin() + i, false);
+				_keys.insert(_keys.begin() + i, val);
+				return ft::pair<iterator, bool>(begin() + i, true);
+			}
+
+			//The hint is used when it is exactly the insertion point
+			iterator	insert(iterator position, const value_type &val)
+			{
+				size_type i = position - begin();
+
+				if ((i == 0 || _comp(_keys[i - 1], val)) && (i == size() || _comp(val, _keys[i])))
+				{
+					_keys.insert(_keys.begin() + i, val);
+					return (begin() + i);
+				}
+				return (insert(val).first);
+			}
+
+			template<typename Iterator>
+			void	insert(Iterator first, Iterator last)
+			{
+				container_type	staged(_keys.get_allocator());
+
+				for (; first != last; ++first)
+					staged.push_back(*first);
+				_merge(staged);
+			}
+
+			void	erase(iterator position)
+			{ _keys.erase(_keys.begin() + (position - begin())); }
+
+			size_type	erase(const key_type &k)
+			{
+				size_type i = _lower_index(k);
+
+				if (!_found(i, k))
+					return (0);
+				_keys.erase(_keys.begin() + i);
+				return (1);
+			}
+
+			void	erase(iterator first, iterator last)
+			{ _keys.erase(_keys.begin() + (first - begin()), _keys.begin() + (last - begin())); }
+
+			void	swap(flat_set &x)
+			{
+				std::swap(_comp, x._comp);
+				_keys.swap(x._keys);
+			}
+
+			void	clear()
+			{ _keys.clear(); }
+
+			//OBSERVERS
+			key_compare	key_comp() const
+			{ return _comp; }
+
+			value_compare	value_comp() const
+			{ return _comp; }
+
+			//OPERATIONS
+			iterator	find(const key_type &k) const
+			{
+				size_type i = _lower_index(k);
+
+				return (_found(i, k) ? begin() + i : end());
+			}
+
+			size_type	count(const key_type &k) const
+			{ return (_found(_lower_index(k), k) ? 1 : 0); }
+
+			iterator	lower_bound(const key_type &k) const
+			{ return (begin() + _lower_index(k)); }
+
+			iterator	upper_bound(const key_type &k) const
+			{
+				size_type i = _lower_index(k);
+
+				return (begin() + (_found(i, k) ? i + 1 : i));
+			}
+
+			ft::pair<iterator, iterator>	equal_range(const key_type &k) const
+			{ return ft::pair<iterator, iterator>(lower_bound(k), upper_bound(k)); }
+
+			//ALLOCATOR
+			allocator_type	get_allocator() const
+			{ return _keys.get_allocator(); }
+
+			//Friend prototype to have access to the storage outside
+			template<typename K, typename C, typename A>
+			friend bool	operator==(const flat_set<K, C, A>&, const flat_set<K, C, A>&);
+
+			template<typename K, typename C, typename A>
+			friend bool	operator<(const flat_set<K, C, A>&, const flat_set<K, C, A>&);
+	};
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator==(const flat_set<Key, Compare, Alloc> &x,
+		const flat_set<Key, Compare, Alloc> &y)
+	{ return (x._keys == y._keys); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator<(const flat_set<Key, Compare, Alloc> &x,
+		const flat_set<Key, Compare, Alloc> &y)
+	{ return (x._keys < y._keys); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator!=(const flat_set<Key, Compare, Alloc> &x,
+		const flat_set<Key, Compare, Alloc> &y)
+	{ return !(x == y); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator>(const flat_set<Key, Compare, Alloc> &x,
+		const flat_set<Key, Compare, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator<=(const flat_set<Key, Compare, Alloc> &x,
+		const flat_set<Key, Compare, Alloc> &y)
+	{ return !(y < x); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator>=(const flat_set<Key, Compare, Alloc> &x,
+		const flat_set<Key, Compare, Alloc> &y)
+	{ return !(x < y); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline void swap(flat_set<Key, Compare, Alloc> &x, flat_set<Key, Compare, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
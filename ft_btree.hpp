@@ -0,0 +1,1065 @@
+#ifndef FT_BTREE_H
+# define FT_BTREE_H
+
+# include <algorithm>
+# include <iterator>
+# include <memory>
+# include <new>
+# include "ft_iterator.hpp"
+# include "ft_pair.hpp"
+# include "ft_utilities.hpp"
+
+//B+tree backing btree_map and btree_set: values are stored only in the leaves,
+//many per node, and internal nodes hold copies of separator keys. Each node
+//targets FT_BTREE_NODE_BYTES (define it before including, default 256 bytes =
+//4 cache lines), so a lookup touches a few lines per level instead of one
+//line per comparison. Unlike Rb_tree, insert and erase invalidate iterators:
+//elements are copied when nodes split, merge or borrow
+# ifndef FT_BTREE_NODE_BYTES
+#  define FT_BTREE_NODE_BYTES 256
+# endif
+
+namespace ft
+{
+	struct Btree_node_base
+	{
+		Btree_node_base	*parent; //0 for the root
+		unsigned short	count; //values in a leaf, keys in an internal node
+		bool			leaf;
+	};
+
+	//Leaves are chained in key order through a circular list whose sentinel
+	//is the tree header: it is end(), its parent is the root
+	struct Btree_leaf_base : public Btree_node_base
+	{
+		Btree_leaf_base	*prev;
+		Btree_leaf_base	*next;
+	};
+
+	union Btree_storage
+	{
+		long double	ld;
+		double		d;
+		long		l;
+		void		*p;
+	};
+
+	template<typename Value>
+	struct Btree_leaf : public Btree_leaf_base
+	{
+		enum
+		{
+			fit = (FT_BTREE_NODE_BYTES - sizeof(Btree_leaf_base)) / sizeof(Value),
+			slots = fit < 3 ? 3 : fit
+		};
+
+		Btree_storage	storage[(slots * sizeof(Value) + sizeof(Btree_storage) - 1) / sizeof(Btree_storage)];
+
+		Value	*values()
+		{ return (reinterpret_cast<Value*>(storage)); }
+
+		const Value	*values() const
+		{ return (reinterpret_cast<const Value*>(storage)); }
+	};
+
+	template<typename Key>
+	struct Btree_internal : public Btree_node_base
+	{
+		enum
+		{
+			fit = (FT_BTREE_NODE_BYTES - sizeof(Btree_node_base) - sizeof(void*)) / (sizeof(Key) + sizeof(void*)),
+			slots = fit < 3 ? 3 : fit
+		};
+
+		//children[i] holds keys lesser than keys()[i], children[i + 1] the others
+		Btree_node_base	*children[slots + 1];
+		Btree_storage	storage[(slots * sizeof(Key) + sizeof(Btree_storage) - 1) / sizeof(Btree_storage)];
+
+		Key	*keys()
+		{ return (reinterpret_cast<Key*>(storage)); }
+
+		const Key	*keys() const
+		{ return (reinterpret_cast<const Key*>(storage)); }
+	};
+
+	template<typename T>
+	struct	Btree_iterator
+	{
+		typedef	T	value_type;
+		typedef T&	reference;
+		typedef T*	pointer;
+
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef ptrdiff_t						difference_type;
+
+		typedef Btree_iterator<T>	self;
+		typedef Btree_leaf_base*	node_ptr;
+
+		node_ptr	node;
+		size_t		index;
+
+		Btree_iterator() : node(), index() {}
+
+		Btree_iterator(node_ptr x, size_t i) : node(x), index(i) {}
+
+		reference	operator*() const
+		{ return (static_cast<Btree_leaf<T>*>(node)->values()[index]); }
+
+		pointer	operator->() const
+		{ return &(operator*()); }
+
+		self	&operator++()
+		{
+			if (++index == node->count)
+			{
+				node = node->next;
+				index = 0;
+			}
+			return (*this);
+		}
+
+		self	operator++(int)
+		{
+			self tmp = *this;
+			++*this;
+			return (tmp);
+		}
+
+		self	&operator--()
+		{
+			if (index == 0)
+			{
+				node = node->prev;
+				index = node->count;
+			}
+			--index;
+			return (*this);
+		}
+
+		self	operator--(int)
+		{
+			self tmp = *this;
+			--*this;
+			return (tmp);
+		}
+
+		bool	operator==(const self	&x) const
+		{ return (node == x.node && index == x.index); }
+
+		bool	operator!=(const self	&x) const
+		{ return !(*this == x); }
+	};
+
+	template<typename T>
+	struct	Const_btree_iterator
+	{
+		typedef	T			value_type;
+		typedef const T*	pointer;
+		typedef const T&	reference;
+
+		typedef	Btree_iterator<T> iterator;
+
+		typedef std::bidirectional_iterator_tag	iterator_category;
+		typedef ptrdiff_t						difference_type;
+
+		typedef Const_btree_iterator<T>	self;
+		typedef const Btree_leaf_base*	node_ptr;
+
+		node_ptr	node;
+		size_t		index;
+
+		Const_btree_iterator() : node(), index() {}
+
+		Const_btree_iterator(node_ptr x, size_t i) : node(x), index(i) {}
+
+		Const_btree_iterator(const iterator &it) : node(it.node), index(it.index) {}
+
+		iterator	it_const_cast() const
+		{ return iterator(const_cast<typename iterator::node_ptr>(node), index); }
+
+		reference	operator*() const
+		{ return (static_cast<const Btree_leaf<T>*>(node)->values()[index]); }
+
+		pointer	operator->() const
+		{ return &(operator*()); }
+
+		self	&operator++()
+		{
+			if (++index == node->count)
+			{
+				node = node->next;
+				index = 0;
+			}
+			return (*this);
+		}
+
+		self	operator++(int)
+		{
+			self tmp = *this;
+			++*this;
+			return (tmp);
+		}
+
+		self	&operator--()
+		{
+			if (index == 0)
+			{
+				node = node->prev;
+				index = node->count;
+			}
+			--index;
+			return (*this);
+		}
+
+		self	operator--(int)
+		{
+			self tmp = *this;
+			--*this;
+			return (tmp);
+		}
+
+		bool	operator==(const self	&x) const
+		{ return (node == x.node && index == x.index); }
+
+		bool	operator!=(const self	&x) const
+		{ return !(*this == x); }
+	};
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare, typename Alloc = std::allocator<Value> >
+	class Btree
+	{
+		public:
+			typedef Key				key_type;
+			typedef	Value			value_type;
+			typedef Compare			key_compare;
+			typedef	Value*			pointer;
+			typedef const Value*	const_pointer;
+			typedef Value&			reference;
+			typedef const Value&	const_reference;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			typedef Alloc	allocator_type;
+
+			typedef	Btree_iterator<value_type>			iterator;
+			typedef Const_btree_iterator<value_type>	const_iterator;
+
+			typedef ft::reverse_iterator<iterator>			reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+		private:
+			typedef Btree_node_base			node_base;
+			typedef node_base*				base_ptr;
+			typedef const node_base*		const_base_ptr;
+			typedef Btree_leaf_base			link_type;
+			typedef link_type*				link_ptr;
+			typedef Btree_leaf<Value>		leaf_node;
+			typedef leaf_node*				leaf_ptr;
+			typedef const leaf_node*		const_leaf_ptr;
+			typedef Btree_internal<Key>		internal_node;
+			typedef internal_node*			internal_ptr;
+			typedef const internal_node*	const_internal_ptr;
+
+			typedef typename Alloc::template rebind<leaf_node>::other		leaf_allocator;
+			typedef typename Alloc::template rebind<internal_node>::other	internal_allocator;
+
+			enum
+			{
+				leaf_slots = leaf_node::slots,
+				internal_slots = internal_node::slots,
+				min_leaf = leaf_slots / 2,
+				min_internal = internal_slots / 2,
+				max_height = sizeof(size_type) * 8
+			};
+
+			allocator_type		_alloc;
+			leaf_allocator		_leaf_alloc;
+			internal_allocator	_internal_alloc;
+			key_compare			_comp;
+			link_type			_header;
+			size_type			_count;
+
+			void	_initialize_header()
+			{
+				_header.parent = 0;
+				_header.count = 0;
+				_header.leaf = true;
+				_header.prev = &_header;
+				_header.next = &_header;
+			}
+
+			base_ptr	&_root()
+			{ return (_header.parent); }
+
+			const_base_ptr	_root() const
+			{ return (_header.parent); }
+
+			static leaf_ptr	_leaf(base_ptr x)
+			{ return (static_cast<leaf_ptr>(x)); }
+
+			static const_leaf_ptr	_leaf(const_base_ptr x)
+			{ return (static_cast<const_leaf_ptr>(x)); }
+
+			static internal_ptr	_internal(base_ptr x)
+			{ return (static_cast<internal_ptr>(x)); }
+
+			static const_internal_ptr	_internal(const_base_ptr x)
+			{ return (static_cast<const_internal_ptr>(x)); }
+
+			static const key_type	&_key(const_leaf_ptr x, size_type i)
+			{ return (KeyOfValue()(x->values()[i])); }
+
+			//Nodes
+			leaf_ptr	_create_leaf()
+			{
+				leaf_ptr x = _leaf_alloc.allocate(1);
+
+				x->parent = 0;
+				x->count = 0;
+				x->leaf = true;
+				x->prev = 0;
+				x->next = 0;
+				return (x);
+			}
+
+			internal_ptr	_create_internal()
+			{
+				internal_ptr x = _internal_alloc.allocate(1);
+
+				x->parent = 0;
+				x->count = 0;
+				x->leaf = false;
+				return (x);
+			}
+
+			void	_destroy(base_ptr x)
+			{
+				if (x->leaf)
+				{
+					for (size_type i = 0; i < x->count; ++i)
+						_alloc.destroy(_leaf(x)->values() + i);
+					_leaf_alloc.deallocate(_leaf(x), 1);
+					return ;
+				}
+				for (size_type i = 0; i <= x->count; ++i)
+					_destroy(_internal(x)->children[i]);
+				for (size_type i = 0; i < x->count; ++i)
+					_internal(x)->keys()[i].~key_type();
+				_internal_alloc.deallocate(_internal(x), 1);
+			}
+
+			static void	_link_after(link_ptr pos, link_ptr x)
+			{
+				x->prev = pos;
+				x->next = pos->next;
+				pos->next->prev = x;
+				pos->next = x;
+			}
+
+			static void	_unlink(link_ptr x)
+			{
+				x->prev->next = x->next;
+				x->next->prev = x->prev;
+			}
+
+			//Moves n values (or keys) from src to dst, ranges may overlap
+			void	_relocate(value_type *dst, value_type *src, size_type n)
+			{
+				if (dst < src)
+				{
+					for (size_type i = 0; i < n; ++i)
+					{
+						_alloc.construct(dst + i, src[i]);
+						_alloc.destroy(src + i);
+					}
+				}
+				else
+				{
+					while (n--)
+					{
+						_alloc.construct(dst + n, src[n]);
+						_alloc.destroy(src + n);
+					}
+				}
+			}
+
+			static void	_relocate_keys(key_type *dst, key_type *src, size_type n)
+			{
+				if (dst < src)
+				{
+					for (size_type i = 0; i < n; ++i)
+					{
+						::new(static_cast<void*>(dst + i)) key_type(src[i]);
+						src[i].~key_type();
+					}
+				}
+				else
+				{
+					while (n--)
+					{
+						::new(static_cast<void*>(dst + n)) key_type(src[n]);
+						src[n].~key_type();
+					}
+				}
+			}
+
+			static void	_set_key(internal_ptr x, size_type i, const key_type &k)
+			{
+				x->keys()[i].~key_type();
+				::new(static_cast<void*>(x->keys() + i)) key_type(k);
+			}
+
+			static void	_set_child(internal_ptr x, size_type i, base_ptr child)
+			{
+				x->children[i] = child;
+				child->parent = x;
+			}
+
+			//Searches, binary inside a node
+			size_type	_lower_in_leaf(const_leaf_ptr x, const key_type &k) const
+			{
+				size_type	lo = 0;
+				size_type	n = x->count;
+
+				while (n > 0)
+				{
+					const size_type half = n / 2;
+
+					if (_comp(_key(x, lo + half), k))
+					{
+						lo += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return (lo);
+			}
+
+			size_type	_upper_in_leaf(const_leaf_ptr x, const key_type &k) const
+			{
+				size_type	lo = 0;
+				size_type	n = x->count;
+
+				while (n > 0)
+				{
+					const size_type half = n / 2;
+
+					if (!_comp(k, _key(x, lo + half)))
+					{
+						lo += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return (lo);
+			}
+
+			//Index of the child whose range holds k
+			size_type	_child_for(const_internal_ptr x, const key_type &k) const
+			{
+				size_type	lo = 0;
+				size_type	n = x->count;
+
+				while (n > 0)
+				{
+					const size_type half = n / 2;
+
+					if (!_comp(k, x->keys()[lo + half]))
+					{
+						lo += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return (lo);
+			}
+
+			static size_type	_child_index(const_internal_ptr p, const_base_ptr x)
+			{
+				size_type i = 0;
+
+				while (p->children[i] != x)
+					++i;
+				return (i);
+			}
+
+			//Leaf where k is or would be inserted, the tree must not be empty
+			leaf_ptr	_descend(const key_type &k) const
+			{
+				const_base_ptr x = _root();
+
+				while (!x->leaf)
+					x = _internal(x)->children[_child_for(_internal(x), k)];
+				return (const_cast<leaf_ptr>(_leaf(x)));
+			}
+
+			//Positions past the last value of a leaf are the first of the next
+			static iterator	_make_iterator(link_ptr x, size_type i)
+			{
+				if (i == x->count)
+					return (iterator(x->next, 0));
+				return (iterator(x, i));
+			}
+
+			iterator	_bound(const key_type &k, bool upper) const
+			{
+				if (_root() == 0)
+					return (iterator(const_cast<link_ptr>(&_header), 0));
+				leaf_ptr x = _descend(k);
+
+				return (_make_iterator(x, upper ? _upper_in_leaf(x, k) : _lower_in_leaf(x, k)));
+			}
+
+			//Insertion
+			//Constructs val at index i of a non full leaf
+			void	_put(leaf_ptr x, size_type i, const value_type &val)
+			{
+				_relocate(x->values() + i + 1, x->values() + i, x->count - i);
+				try
+				{ _alloc.construct(x->values() + i, val); }
+				catch (...)
+				{
+					_relocate(x->values() + i, x->values() + i + 1, x->count - i);
+					throw;
+				}
+				++x->count;
+			}
+
+			void	_internal_insert(internal_ptr x, size_type pos, const key_type &k, base_ptr child)
+			{
+				_relocate_keys(x->keys() + pos + 1, x->keys() + pos, x->count - pos);
+				::new(static_cast<void*>(x->keys() + pos)) key_type(k);
+				for (size_type i = x->count + 1; i > pos + 1; --i)
+					x->children[i] = x->children[i - 1];
+				_set_child(x, pos + 1, child);
+				++x->count;
+			}
+
+			bool	_is_right_edge(const_base_ptr x) const
+			{
+				for (; x->parent != 0; x = x->parent)
+					if (_internal(x->parent)->children[x->parent->count] != x)
+						return (false);
+				return (true);
+			}
+
+			//Allocates every internal node a split of leaf x can need (one
+			//per full ancestor, plus a new root), so that running out of
+			//memory is detected before anything is modified
+			size_type	_reserve_internals(const_base_ptr x, internal_ptr *spare)
+			{
+				size_type		n = 0;
+				size_type		needed = 1;
+				const_base_ptr	p = x->parent;
+
+				for (; p != 0 && p->count == internal_slots; p = p->parent)
+					++needed;
+				if (p != 0)
+					--needed;
+				try
+				{
+					for (; n < needed; ++n)
+						spare[n] = _create_internal();
+				}
+				catch (...)
+				{
+					_free_internals(spare, n);
+					throw;
+				}
+				return (n);
+			}
+
+			void	_free_internals(internal_ptr *spare, size_type n)
+			{
+				while (n--)
+					_internal_alloc.deallocate(spare[n], 1);
+			}
+
+			//Links right (whose keys are not lesser than sep) after left
+			void	_insert_in_parent(base_ptr left, const key_type &sep, base_ptr right, internal_ptr *spare, size_type &n)
+			{
+				internal_ptr p = _internal(left->parent);
+
+				if (p == 0)
+				{
+					p = spare[--n];
+					::new(static_cast<void*>(p->keys())) key_type(sep);
+					_set_child(p, 0, left);
+					_set_child(p, 1, right);
+					p->count = 1;
+					_root() = p;
+					return ;
+				}
+				const size_type pos = _child_index(p, left);
+
+				if (p->count < internal_slots)
+				{
+					_internal_insert(p, pos, sep, right);
+					return ;
+				}
+				//Full: keys()[mid] moves up, the upper part goes to q. Appends
+				//on the right edge leave p full instead of half empty
+				internal_ptr	q = spare[--n];
+				const size_type	mid = (pos == p->count && _is_right_edge(p)) ? p->count - 1 : p->count / 2;
+				const key_type	up(p->keys()[mid]);
+
+				_relocate_keys(q->keys(), p->keys() + mid + 1, p->count - mid - 1);
+				for (size_type i = mid + 1; i <= p->count; ++i)
+					_set_child(q, i - mid - 1, p->children[i]);
+				q->count = p->count - mid - 1;
+				p->keys()[mid].~key_type();
+				p->count = mid;
+				if (pos <= mid)
+					_internal_insert(p, pos, sep, right);
+				else
+					_internal_insert(q, pos - mid - 1, sep, right);
+				_insert_in_parent(p, up, q, spare, n);
+			}
+
+			iterator	_insert_in_leaf(leaf_ptr x, size_type i, const value_type &val)
+			{
+				if (x->count < leaf_slots)
+				{
+					_put(x, i, val);
+					++_count;
+					return (iterator(x, i));
+				}
+				internal_ptr	spare[max_height];
+				size_type		n = _reserve_internals(x, spare);
+				leaf_ptr		y;
+
+				try
+				{ y = _create_leaf(); }
+				catch (...)
+				{
+					_free_internals(spare, n);
+					throw;
+				}
+				//Appending to the last leaf moves nothing, so sorted input
+				//builds full leaves
+				const size_type	mid = (i == x->count && x->next == &_header) ? x->count : x->count / 2;
+				leaf_ptr		target = x;
+
+				_relocate(y->values(), x->values() + mid, x->count - mid);
+				y->count = x->count - mid;
+				x->count = mid;
+				_link_after(x, y);
+				if (i >= mid)
+				{
+					target = y;
+					i -= mid;
+				}
+				try
+				{ _put(target, i, val); }
+				catch (...)
+				{
+					_relocate(x->values() + x->count, y->values(), y->count);
+					x->count += y->count;
+					_unlink(y);
+					_leaf_alloc.deallocate(y, 1);
+					_free_internals(spare, n);
+					throw;
+				}
+				++_count;
+				_insert_in_parent(x, _key(y, 0), y, spare, n);
+				return (iterator(target, i));
+			}
+
+			iterator	_insert_first(const value_type &val)
+			{
+				leaf_ptr x = _create_leaf();
+
+				try
+				{ _alloc.construct(x->values(), val); }
+				catch (...)
+				{
+					_leaf_alloc.deallocate(x, 1);
+					throw;
+				}
+				x->count = 1;
+				_link_after(&_header, x);
+				_root() = x;
+				_count = 1;
+				return (iterator(x, 0));
+			}
+
+			//Erasure
+			void	_remove_from_internal(internal_ptr x, size_type key_index)
+			{
+				x->keys()[key_index].~key_type();
+				_relocate_keys(x->keys() + key_index, x->keys() + key_index + 1, x->count - key_index - 1);
+				for (size_type i = key_index + 1; i < x->count; ++i)
+					x->children[i] = x->children[i + 1];
+				--x->count;
+			}
+
+			void	_rebalance_leaf(leaf_ptr x)
+			{
+				if (x->parent == 0)
+				{
+					if (x->count == 0)
+					{
+						_leaf_alloc.deallocate(x, 1);
+						_initialize_header();
+					}
+					return ;
+				}
+				if (x->count >= min_leaf)
+					return ;
+				internal_ptr	p = _internal(x->parent);
+				const size_type	pos = _child_index(p, x);
+				leaf_ptr		left = pos > 0 ? _leaf(p->children[pos - 1]) : 0;
+				leaf_ptr		right = pos < p->count ? _leaf(p->children[pos + 1]) : 0;
+
+				if (left && left->count > min_leaf)
+				{
+					_relocate(x->values() + 1, x->values(), x->count);
+					_relocate(x->values(), left->values() + left->count - 1, 1);
+					--left->count;
+					++x->count;
+					_set_key(p, pos - 1, _key(x, 0));
+				}
+				else if (right && right->count > min_leaf)
+				{
+					_relocate(x->values() + x->count, right->values(), 1);
+					_relocate(right->values(), right->values() + 1, right->count - 1);
+					--right->count;
+					++x->count;
+					_set_key(p, pos, _key(right, 0));
+				}
+				else
+				{
+					if (left)
+					{
+						right = x;
+						x = left;
+					}
+					_relocate(x->values() + x->count, right->values(), right->count);
+					x->count += right->count;
+					_remove_from_internal(p, left ? pos - 1 : pos);
+					_unlink(right);
+					_leaf_alloc.deallocate(right, 1);
+					_rebalance_internal(p);
+				}
+			}
+
+			void	_rebalance_internal(internal_ptr x)
+			{
+				if (x->parent == 0)
+				{
+					if (x->count == 0)
+					{
+						_root() = x->children[0];
+						_root()->parent = 0;
+						_internal_alloc.deallocate(x, 1);
+					}
+					return ;
+				}
+				if (x->count >= min_internal)
+					return ;
+				internal_ptr	p = _internal(x->parent);
+				const size_type	pos = _child_index(p, x);
+				internal_ptr	left = pos > 0 ? _internal(p->children[pos - 1]) : 0;
+				internal_ptr	right = pos < p->count ? _internal(p->children[pos + 1]) : 0;
+
+				if (left && left->count > min_internal)
+				{
+					_relocate_keys(x->keys() + 1, x->keys(), x->count);
+					::new(static_cast<void*>(x->keys())) key_type(p->keys()[pos - 1]);
+					for (size_type i = x->count + 1; i > 0; --i)
+						x->children[i] = x->children[i - 1];
+					_set_child(x, 0, left->children[left->count]);
+					++x->count;
+					_set_key(p, pos - 1, left->keys()[left->count - 1]);
+					left->keys()[--left->count].~key_type();
+				}
+				else if (right && right->count > min_internal)
+				{
+					::new(static_cast<void*>(x->keys() + x->count)) key_type(p->keys()[pos]);
+					_set_child(x, x->count + 1, right->children[0]);
+					++x->count;
+					_set_key(p, pos, right->keys()[0]);
+					right->keys()[0].~key_type();
+					_relocate_keys(right->keys(), right->keys() + 1, right->count - 1);
+					for (size_type i = 0; i < right->count; ++i)
+						right->children[i] = right->children[i + 1];
+					--right->count;
+				}
+				else
+				{
+					if (left)
+					{
+						right = x;
+						x = left;
+					}
+					const size_type sep = left ? pos - 1 : pos;
+
+					::new(static_cast<void*>(x->keys() + x->count)) key_type(p->keys()[sep]);
+					_relocate_keys(x->keys() + x->count + 1, right->keys(), right->count);
+					for (size_type i = 0; i <= right->count; ++i)
+						_set_child(x, x->count + 1 + i, right->children[i]);
+					x->count += right->count + 1;
+					_internal_alloc.deallocate(right, 1);
+					_remove_from_internal(p, sep);
+					_rebalance_internal(p);
+				}
+			}
+
+			void	_erase(iterator position)
+			{
+				leaf_ptr x = static_cast<leaf_ptr>(position.node);
+
+				_alloc.destroy(x->values() + position.index);
+				_relocate(x->values() + position.index, x->values() + position.index + 1, x->count - position.index - 1);
+				--x->count;
+				--_count;
+				_rebalance_leaf(x);
+			}
+
+		public:
+			//CONSTRUCTOR && DESTRUCTOR && operator=
+			Btree(const key_compare &c = key_compare(), const allocator_type &a = allocator_type())
+			: _alloc(a), _leaf_alloc(a), _internal_alloc(a), _comp(c), _count(0)
+			{ _initialize_header(); }
+
+			Btree(const Btree &x)
+			: _alloc(x._alloc), _leaf_alloc(x._leaf_alloc), _internal_alloc(x._internal_alloc), _comp(x._comp), _count(0)
+			{
+				_initialize_header();
+				try
+				{ insert_unique(x.begin(), x.end()); }
+				catch (...)
+				{
+					clear();
+					throw;
+				}
+			}
+
+			~Btree()
+			{ clear(); }
+
+			Btree	&operator=(const Btree &src)
+			{
+				if (this != &src)
+				{
+					clear();
+					_comp = src._comp;
+					insert_unique(src.begin(), src.end());
+				}
+				return (*this);
+			}
+
+			//Allocator
+			allocator_type	get_allocator() const
+			{ return (_alloc); }
+
+			//Iterators
+			iterator	begin()
+			{ return iterator(_header.next, 0); }
+
+			const_iterator	begin() const
+			{ return const_iterator(_header.next, 0); }
+
+			iterator	end()
+			{ return iterator(&_header, 0); }
+
+			const_iterator	end() const
+			{ return const_iterator(&_header, 0); }
+
+			reverse_iterator	rbegin()
+			{ return reverse_iterator(end()); }
+
+			const_reverse_iterator rbegin() const
+			{ return const_reverse_iterator(end()); }
+
+			reverse_iterator	rend()
+			{ return reverse_iterator(begin()); }
+
+			const_reverse_iterator rend() const
+			{ return const_reverse_iterator(begin()); }
+
+			//Utils
+			Compare	key_comp() const
+			{ return (_comp); }
+
+			size_type	size() const
+			{ return (_count); }
+
+			bool	empty() const
+			{ return (_count == 0); }
+
+			size_type	max_size() const
+			{ return (_alloc.max_size()); }
+
+			//Operations
+			iterator	lower_bound(const key_type &k)
+			{ return (_bound(k, false)); }
+
+			const_iterator	lower_bound(const key_type &k) const
+			{ return (_bound(k, false)); }
+
+			iterator	upper_bound(const key_type &k)
+			{ return (_bound(k, true)); }
+
+			const_iterator	upper_bound(const key_type &k) const
+			{ return (_bound(k, true)); }
+
+			ft::pair<iterator, iterator>	equal_range(const key_type &k)
+			{ return (ft::pair<iterator, iterator>(lower_bound(k), upper_bound(k))); }
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+			{ return (ft::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k))); }
+
+			iterator	find(const key_type &k)
+			{
+				iterator find = lower_bound(k);
+
+				if (find == end() || _comp(k, KeyOfValue()(*find)))
+					return end();
+				return find;
+			}
+
+			const_iterator	find(const key_type &k) const
+			{
+				const_iterator find = lower_bound(k);
+
+				if (find == end() || _comp(k, KeyOfValue()(*find)))
+					return end();
+				return find;
+			}
+
+			size_type	count(const key_type &k) const
+			{ return (find(k) == end() ? 0 : 1); }
+
+			//insert
+			ft::pair<iterator, bool>	insert_unique(const value_type &val)
+			{
+				const key_type &k = KeyOfValue()(val);
+
+				if (_root() == 0)
+					return (ft::pair<iterator, bool>(_insert_first(val), true));
+				leaf_ptr		x = _descend(k);
+				const size_type	i = _lower_in_leaf(x, k);
+
+				if (i != x->count && !_comp(k, _key(x, i)))
+					return (ft::pair<iterator, bool>(iterator(x, i), false));
+				return (ft::pair<iterator, bool>(_insert_in_leaf(x, i, val), true));
+			}
+
+			//The hint is used when val goes right before it in the same leaf,
+			//or at the very beginning or end of the tree
+			iterator	insert_unique(const_iterator position, const value_type &val)
+			{
+				const key_type	&k = KeyOfValue()(val);
+				link_ptr		x = const_cast<link_ptr>(position.node);
+				size_type		i = position.index;
+
+				if (_root() == 0)
+					return (_insert_first(val));
+				if (x == &_header)
+				{
+					x = _header.prev;
+					i = x->count;
+				}
+				const leaf_ptr l = static_cast<leaf_ptr>(x);
+
+				if ((i == 0 ? x == _header.next : _comp(_key(l, i - 1), k))
+					&& (i == x->count ? x == _header.prev : _comp(k, _key(l, i))))
+					return (_insert_in_leaf(l, i, val));
+				return (insert_unique(val).first);
+			}
+
+			template<typename Iterator>
+			void	insert_unique(Iterator first, Iterator last)
+			{
+				for (; first != last; ++first)
+					insert_unique(end(), *first);
+			}
+
+			//erase
+			void	erase(const_iterator position)
+			{ _erase(position.it_const_cast()); }
+
+			size_type	erase(const key_type &k)
+			{
+				iterator it = find(k);
+
+				if (it == end())
+					return (0);
+				_erase(it);
+				return (1);
+			}
+
+			//Nodes are reorganized by each erasure, so the range is walked
+			//by key: the next element is always the lower bound of the last
+			//erased one
+			void	erase(const_iterator first, const_iterator last)
+			{
+				if (first == begin() && last == end())
+				{
+					clear();
+					return ;
+				}
+				size_type n = 0;
+
+				for (const_iterator it = first; it != last; ++it)
+					++n;
+				while (n--)
+				{
+					iterator		it = first.it_const_cast();
+					const key_type	k = KeyOfValue()(*it);
+
+					_erase(it);
+					first = lower_bound(k);
+				}
+			}
+
+			void	clear()
+			{
+				if (_root() != 0)
+					_destroy(_root());
+				_initialize_header();
+				_count = 0;
+			}
+
+			void	swap(Btree &tree)
+			{
+				std::swap(_alloc, tree._alloc);
+				std::swap(_leaf_alloc, tree._leaf_alloc);
+				std::swap(_internal_alloc, tree._internal_alloc);
+				std::swap(_comp, tree._comp);
+				std::swap(_count, tree._count);
+				std::swap(_header.parent, tree._header.parent);
+				std::swap(_header.prev, tree._header.prev);
+				std::swap(_header.next, tree._header.next);
+				_fix_header();
+				tree._fix_header();
+			}
+
+		private:
+			void	_fix_header()
+			{
+				if (_root() == 0)
+					_initialize_header();
+				else
+				{
+					_header.next->prev = &_header;
+					_header.prev->next = &_header;
+				}
+			}
+	};
+	//Operators
+	template<typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
+	inline	bool	operator==(const Btree<Key, Val, KeyOfValue, Compare, Alloc> &x,
+	const Btree<Key, Val, KeyOfValue, Compare, Alloc> &y)
+	{ return (x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin())); }
+
+	template<typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
+	inline	bool	operator<(const Btree<Key, Val, KeyOfValue, Compare, Alloc> &x,
+	const Btree<Key, Val, KeyOfValue, Compare, Alloc> &y)
+	{ return (ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end())); }
+}
+#endif
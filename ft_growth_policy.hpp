@@ -0,0 +1,98 @@
+#ifndef FT_GROWTH_POLICY_HPP
+# define FT_GROWTH_POLICY_HPP
+
+# include <cstddef>
+
+//Growth policies of ft::vector (third template parameter). A policy has
+//  static size_t grow(size_t size, size_t required, size_t elem_size)
+//    capacity to reallocate to when size elements must become required
+//  static size_t round_up(size_t n, size_t elem_size)
+//    capacity actually reserved for a request of n elements
+//Both must return at least their request, vector clamps them to max_size()
+namespace ft
+{
+  //////////////////GROWTH_DOUBLE//////////////////
+  //Default: amortized O(1) appends, up to 50% of the block unused
+  struct growth_double
+  {
+    static size_t grow(size_t size, size_t required, size_t)
+    { return (required > size * 2 ? required : size * 2); }
+
+    static size_t round_up(size_t n, size_t)
+    { return (n); }
+  };
+
+  //////////////////GROWTH_1_5//////////////////
+  //At most 33% unused, and the blocks freed by earlier growth can add up
+  //to a later request, so the allocator may reuse them
+  struct growth_1_5
+  {
+    static size_t grow(size_t size, size_t required, size_t)
+    {
+      const size_t len = size + size / 2;
+
+      return (required > len ? required : len);
+    }
+
+    static size_t round_up(size_t n, size_t)
+    { return (n); }
+  };
+
+  //////////////////GROWTH_EXACT//////////////////
+  //No slack at all: every growth reallocates, appends become O(n). For
+  //vectors sized once by reserve() or range operations
+  struct growth_exact
+  {
+    static size_t grow(size_t, size_t required, size_t)
+    { return (required); }
+
+    static size_t round_up(size_t n, size_t)
+    { return (n); }
+  };
+
+  //////////////////GROWTH_PAGE//////////////////
+  //Doubling rounded up to whole pages, the tail of the last page (that
+  //the system hands out anyway for big blocks) holds elements
+  struct growth_page
+  {
+    enum { page_size = 4096 };
+
+    static size_t grow(size_t size, size_t required, size_t elem_size)
+    { return (round_up(growth_double::grow(size, required, elem_size), elem_size)); }
+
+    static size_t round_up(size_t n, size_t elem_size)
+    {
+      const size_t bytes = n * elem_size;
+
+      if (n == 0 || bytes / elem_size != n)
+        return (n);
+      return (((bytes + page_size - 1) & ~size_t(page_size - 1)) / elem_size);
+    }
+  };
+
+  //////////////////GROWTH_SIZE_CLASS//////////////////
+  //1.5x growth rounded up to the size classes of jemalloc-like allocators
+  //(four classes per power of two, 16 bytes minimum) so no byte of the
+  //block the allocator returns is wasted
+  struct growth_size_class
+  {
+    static size_t grow(size_t size, size_t required, size_t elem_size)
+    { return (round_up(growth_1_5::grow(size, required, elem_size), elem_size)); }
+
+    static size_t round_up(size_t n, size_t elem_size)
+    {
+      const size_t bytes = n * elem_size;
+      size_t       step = 16;
+
+      if (n == 0 || bytes / elem_size != n)
+        return (n);
+      while (step * 8 <= bytes && step * 8 > step)
+        step *= 2;
+      if (bytes + step - 1 < bytes)
+        return (n);
+      return (((bytes + step - 1) & ~(step - 1)) / elem_size);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,717 @@
+#ifndef FT_HASHTABLE_H
+# define FT_HASHTABLE_H
+
+# include <algorithm>
+# include <functional>
+# include <iterator>
+# include <memory>
+# include <string>
+# include "ft_pair.hpp"
+# include "vector.hpp"
+
+//Open addressing table backing unordered_map and unordered_set: one flat
+//array of values plus one byte per slot holding the probe distance + 1
+//(0 marks an empty slot). Robin Hood insertion keeps every probe sequence
+//sorted by distance, so lookups stop at the first slot poorer than the
+//searched key, and erasure shifts the following run back instead of
+//leaving tombstones. Insert, erase and rehash move elements: they
+//invalidate iterators, pointers and references. A probe run longer than
+//255 slots forces a rehash, so the hash must not map hundreds of keys to
+//the same value
+namespace ft
+{
+	//Hash functions, specialize ft::hash for other key types
+	template<typename T>
+	struct hash;
+
+	template<typename T>
+	struct hash<T*>
+	{
+		size_t	operator()(T *p) const
+		{ return (reinterpret_cast<size_t>(p)); }
+	};
+
+	template<>
+	struct hash<bool>
+	{ size_t operator()(bool x) const { return (x); } };
+	template<>
+	struct hash<char>
+	{ size_t operator()(char x) const { return (x); } };
+	template<>
+	struct hash<signed char>
+	{ size_t operator()(signed char x) const { return (x); } };
+	template<>
+	struct hash<unsigned char>
+	{ size_t operator()(unsigned char x) const { return (x); } };
+	template<>
+	struct hash<short>
+	{ size_t operator()(short x) const { return (x); } };
+	template<>
+	struct hash<unsigned short>
+	{ size_t operator()(unsigned short x) const { return (x); } };
+	template<>
+	struct hash<int>
+	{ size_t operator()(int x) const { return (x); } };
+	template<>
+	struct hash<unsigned int>
+	{ size_t operator()(unsigned int x) const { return (x); } };
+	template<>
+	struct hash<long>
+	{ size_t operator()(long x) const { return (x); } };
+	template<>
+	struct hash<unsigned long>
+	{ size_t operator()(unsigned long x) const { return (x); } };
+
+	//FNV-1a
+	template<>
+	struct hash<std::string>
+	{
+		size_t	operator()(const std::string &s) const
+		{
+			size_t h = static_cast<size_t>(14695981039346656037UL);
+
+			for (std::string::size_type i = 0; i < s.size(); ++i)
+			{
+				h ^= static_cast<unsigned char>(s[i]);
+				h *= static_cast<size_t>(1099511628211UL);
+			}
+			return (h);
+		}
+	};
+
+	//Metadata of tables without storage: a single non empty byte, so that
+	//iteration stops right away
+	inline const unsigned char	*hashtable_empty_meta()
+	{
+		static const unsigned char	sentinel = 1;
+
+		return (&sentinel);
+	}
+
+	template<typename T>
+	struct	Hashtable_iterator
+	{
+		typedef	T	value_type;
+		typedef T&	reference;
+		typedef T*	pointer;
+
+		typedef std::forward_iterator_tag	iterator_category;
+		typedef ptrdiff_t					difference_type;
+
+		typedef Hashtable_iterator<T>	self;
+
+		T					*slot;
+		const unsigned char	*meta;
+
+		Hashtable_iterator() : slot(), meta() {}
+
+		Hashtable_iterator(T *s, const unsigned char *m) : slot(s), meta(m) {}
+
+		reference	operator*() const
+		{ return (*slot); }
+
+		pointer	operator->() const
+		{ return (slot); }
+
+		//The metadata array ends with a non empty sentinel
+		self	&operator++()
+		{
+			do
+			{
+				++slot;
+				++meta;
+			} while (*meta == 0);
+			return (*this);
+		}
+
+		self	operator++(int)
+		{
+			self tmp = *this;
+			++*this;
+			return (tmp);
+		}
+
+		bool	operator==(const self	&x) const
+		{ return (meta == x.meta); }
+
+		bool	operator!=(const self	&x) const
+		{ return (meta != x.meta); }
+	};
+
+	template<typename T>
+	struct	Const_hashtable_iterator
+	{
+		typedef	T			value_type;
+		typedef const T&	reference;
+		typedef const T*	pointer;
+
+		typedef	Hashtable_iterator<T> iterator;
+
+		typedef std::forward_iterator_tag	iterator_category;
+		typedef ptrdiff_t					difference_type;
+
+		typedef Const_hashtable_iterator<T>	self;
+
+		const T				*slot;
+		const unsigned char	*meta;
+
+		Const_hashtable_iterator() : slot(), meta() {}
+
+		Const_hashtable_iterator(const T *s, const unsigned char *m) : slot(s), meta(m) {}
+
+		Const_hashtable_iterator(const iterator &it) : slot(it.slot), meta(it.meta) {}
+
+		reference	operator*() const
+		{ return (*slot); }
+
+		pointer	operator->() const
+		{ return (slot); }
+
+		self	&operator++()
+		{
+			do
+			{
+				++slot;
+				++meta;
+			} while (*meta == 0);
+			return (*this);
+		}
+
+		self	operator++(int)
+		{
+			self tmp = *this;
+			++*this;
+			return (tmp);
+		}
+
+		bool	operator==(const self	&x) const
+		{ return (meta == x.meta); }
+
+		bool	operator!=(const self	&x) const
+		{ return (meta != x.meta); }
+	};
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename Pred, typename Alloc = std::allocator<Value> >
+	class Hashtable
+	{
+		public:
+			typedef Key				key_type;
+			typedef	Value			value_type;
+			typedef Hash			hasher;
+			typedef Pred			key_equal;
+			typedef	Value*			pointer;
+			typedef const Value*	const_pointer;
+			typedef Value&			reference;
+			typedef const Value&	const_reference;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			typedef Alloc	allocator_type;
+
+			typedef	Hashtable_iterator<value_type>			iterator;
+			typedef Const_hashtable_iterator<value_type>	const_iterator;
+
+		private:
+			typedef typename Alloc::template rebind<unsigned char>::other	meta_allocator;
+
+			enum
+			{
+				min_capacity = 8,
+				max_distance = 255
+			};
+
+			allocator_type	_alloc;
+			meta_allocator	_meta_alloc;
+			hasher			_hash;
+			key_equal		_eq;
+			value_type		*_slots;
+			unsigned char	*_meta; //_capacity + 1 bytes, the last one is a sentinel
+			size_type		_capacity;
+			size_type		_shift;
+			size_type		_count;
+			size_type		_grow_at;
+			float			_max_load;
+
+			//Fibonacci hashing: the top bits of the product select the home
+			//slot, so weak hashes (identity for integers) still spread out
+			size_type	_home(const key_type &k) const
+			{ return ((_hash(k) * static_cast<size_t>(11400714819323198485UL)) >> _shift); }
+
+			size_type	_next(size_type i) const
+			{ return ((i + 1) & (_capacity - 1)); }
+
+			size_type	_prev(size_type i) const
+			{ return ((i - 1) & (_capacity - 1)); }
+
+			static const key_type	&_key(const value_type &v)
+			{ return (KeyOfValue()(v)); }
+
+			iterator	_iterator(size_type i)
+			{ return (iterator(_slots + i, _meta + i)); }
+
+			const_iterator	_iterator(size_type i) const
+			{ return (const_iterator(_slots + i, _meta + i)); }
+
+			void	_initialize()
+			{
+				_slots = 0;
+				_meta = const_cast<unsigned char*>(hashtable_empty_meta());
+				_capacity = 0;
+				_shift = sizeof(size_type) * 8;
+				_count = 0;
+				_grow_at = 0;
+			}
+
+			//Slot holding k, _capacity if there is none
+			size_type	_find_index(const key_type &k) const
+			{
+				if (_count == 0)
+					return (_capacity);
+				size_type	i = _home(k);
+				size_type	d = 1;
+
+				while (_meta[i] >= d)
+				{
+					if (_meta[i] == d && _eq(_key(_slots[i]), k))
+						return (i);
+					++d;
+					i = _next(i);
+				}
+				return (_capacity);
+			}
+
+			//Moves the value of slot from into the empty slot to
+			void	_relocate(size_type to, size_type from)
+			{
+				_alloc.construct(_slots + to, _slots[from]);
+				_alloc.destroy(_slots + from);
+			}
+
+			//Robin Hood insertion of a key known to be absent, the table must
+			//have room. The new value takes the place of the first richer
+			//element, the run after it shifts one slot forward. Returns
+			//_capacity, without modifying anything, when a distance would
+			//not fit in a byte
+			size_type	_insert_new(const value_type &val)
+			{
+				size_type	i = _home(_key(val));
+				size_type	d = 1;
+				size_type	j;
+
+				while (_meta[i] >= d)
+				{
+					++d;
+					i = _next(i);
+				}
+				if (d > max_distance)
+					return (_capacity);
+				for (j = i; _meta[j] != 0; j = _next(j))
+					if (_meta[j] == max_distance)
+						return (_capacity);
+				//The slot left behind is marked empty at each step: if a copy
+				//throws, shifting back from it restores the run
+				try
+				{
+					for (; j != i; j = _prev(j))
+					{
+						_relocate(j, _prev(j));
+						_meta[j] = _meta[_prev(j)] + 1;
+						_meta[_prev(j)] = 0;
+					}
+					_alloc.construct(_slots + i, val);
+				}
+				catch (...)
+				{
+					_erase_shift(j);
+					throw;
+				}
+				_meta[i] = static_cast<unsigned char>(d);
+				++_count;
+				return (i);
+			}
+
+			//Backward shift from the empty slot i, until an empty slot or an
+			//element sitting in its home slot
+			void	_erase_shift(size_type i)
+			{
+				size_type next = _next(i);
+
+				while (_meta[next] > 1)
+				{
+					_relocate(i, next);
+					_meta[i] = _meta[next] - 1;
+					i = next;
+					next = _next(i);
+				}
+				_meta[i] = 0;
+			}
+
+			void	_erase_index(size_type i)
+			{
+				_alloc.destroy(_slots + i);
+				--_count;
+				_erase_shift(i);
+			}
+
+			void	_deallocate()
+			{
+				if (_capacity != 0)
+				{
+					_alloc.deallocate(_slots, _capacity);
+					_meta_alloc.deallocate(_meta, _capacity + 1);
+				}
+			}
+
+			void	_destroy_all()
+			{
+				for (size_type i = 0; _count != 0; ++i)
+				{
+					if (_meta[i] != 0)
+					{
+						_alloc.destroy(_slots + i);
+						_meta[i] = 0;
+						--_count;
+					}
+				}
+			}
+
+			static size_type	_round_capacity(size_type n)
+			{
+				size_type cap = min_capacity;
+
+				while (cap < n)
+					cap *= 2;
+				return (cap);
+			}
+
+			size_type	_min_capacity_for(size_type n) const
+			{ return (static_cast<size_type>(static_cast<double>(n) / _max_load) + 1); }
+
+			//Drops the arrays of an unfinished rehash (destroying the copies
+			//already made) and puts the previous ones back
+			void	_rehash_undo(value_type *slots, unsigned char *meta, size_type capacity,
+				size_type shift, size_type count, size_type grow_at)
+			{
+				_destroy_all();
+				_deallocate();
+				_slots = slots;
+				_meta = meta;
+				_capacity = capacity;
+				_shift = shift;
+				_count = count;
+				_grow_at = grow_at;
+			}
+
+			//Copies every element to a new array of cap slots (a power of two),
+			//the old array is released only once all of them made it. Strong
+			//guarantee: if a copy throws the table is left as it was
+			void	_rehash_to(size_type cap)
+			{
+				value_type		*slots = _alloc.allocate(cap);
+				unsigned char	*meta;
+
+				try
+				{ meta = _meta_alloc.allocate(cap + 1); }
+				catch (...)
+				{
+					_alloc.deallocate(slots, cap);
+					throw;
+				}
+				std::fill(meta, meta + cap, static_cast<unsigned char>(0));
+				meta[cap] = 1;
+
+				value_type		*old_slots = _slots;
+				unsigned char	*old_meta = _meta;
+				const size_type	old_capacity = _capacity;
+				const size_type	old_shift = _shift;
+				const size_type	old_count = _count;
+				const size_type	old_grow_at = _grow_at;
+				size_type		shift = sizeof(size_type) * 8;
+				bool			overflow = false;
+
+				for (size_type c = cap; c > 1; c /= 2)
+					--shift;
+				_slots = slots;
+				_meta = meta;
+				_capacity = cap;
+				_shift = shift;
+				_count = 0;
+				_grow_at = static_cast<size_type>(static_cast<double>(cap) * _max_load);
+				try
+				{
+					for (size_type i = 0; i < old_capacity && !overflow; ++i)
+						if (old_meta[i] != 0)
+							overflow = (_insert_new(old_slots[i]) == _capacity);
+				}
+				catch (...)
+				{
+					_rehash_undo(old_slots, old_meta, old_capacity, old_shift, old_count, old_grow_at);
+					throw;
+				}
+				if (overflow)
+				{
+					//A probe run overflowed: start over twice as large
+					_rehash_undo(old_slots, old_meta, old_capacity, old_shift, old_count, old_grow_at);
+					_rehash_to(cap * 2);
+					return ;
+				}
+				for (size_type i = 0; i < old_capacity; ++i)
+					if (old_meta[i] != 0)
+						_alloc.destroy(old_slots + i);
+				if (old_capacity != 0)
+				{
+					_alloc.deallocate(old_slots, old_capacity);
+					_meta_alloc.deallocate(old_meta, old_capacity + 1);
+				}
+			}
+
+		public:
+			//CONSTRUCTOR && DESTRUCTOR && operator=
+			Hashtable(size_type n = 0, const hasher &hf = hasher(), const key_equal &eq = key_equal(),
+				const allocator_type &a = allocator_type())
+			: _alloc(a), _meta_alloc(a), _hash(hf), _eq(eq), _max_load(0.875f)
+			{
+				_initialize();
+				if (n != 0)
+					_rehash_to(_round_capacity(n));
+			}
+
+			//Same capacity and hash function: every element keeps its slot
+			Hashtable(const Hashtable &x)
+			: _alloc(x._alloc), _meta_alloc(x._meta_alloc), _hash(x._hash), _eq(x._eq), _max_load(x._max_load)
+			{
+				_initialize();
+				if (x._capacity == 0)
+					return ;
+				_rehash_to(x._capacity);
+				try
+				{
+					for (size_type i = 0; i < _capacity; ++i)
+					{
+						if (x._meta[i] != 0)
+						{
+							_alloc.construct(_slots + i, x._slots[i]);
+							_meta[i] = x._meta[i];
+							++_count;
+						}
+					}
+				}
+				catch (...)
+				{
+					_destroy_all();
+					_deallocate();
+					throw;
+				}
+			}
+
+			~Hashtable()
+			{
+				_destroy_all();
+				_deallocate();
+			}
+
+			Hashtable	&operator=(const Hashtable &src)
+			{
+				if (this != &src)
+				{
+					Hashtable tmp(src);
+
+					swap(tmp);
+				}
+				return (*this);
+			}
+
+			//Allocator
+			allocator_type	get_allocator() const
+			{ return (_alloc); }
+
+			//Iterators
+			iterator	begin()
+			{
+				size_type i = 0;
+
+				while (i < _capacity && _meta[i] == 0)
+					++i;
+				return (_iterator(i));
+			}
+
+			const_iterator	begin() const
+			{ return (const_cast<Hashtable*>(this)->begin()); }
+
+			iterator	end()
+			{ return (_iterator(_capacity)); }
+
+			const_iterator	end() const
+			{ return (_iterator(_capacity)); }
+
+			//Utils
+			hasher	hash_function() const
+			{ return (_hash); }
+
+			key_equal	key_eq() const
+			{ return (_eq); }
+
+			size_type	size() const
+			{ return (_count); }
+
+			bool	empty() const
+			{ return (_count == 0); }
+
+			size_type	max_size() const
+			{ return (_alloc.max_size()); }
+
+			//Buckets and load
+			size_type	bucket_count() const
+			{ return (_capacity); }
+
+			float	load_factor() const
+			{ return (_capacity == 0 ? 0.0f : static_cast<float>(_count) / _capacity); }
+
+			float	max_load_factor() const
+			{ return (_max_load); }
+
+			//Clamped to [0.25, 0.95]: probe runs explode when the table is full
+			void	max_load_factor(float z)
+			{
+				_max_load = std::min(std::max(z, 0.25f), 0.95f);
+				_grow_at = static_cast<size_type>(static_cast<double>(_capacity) * _max_load);
+				if (_count > _grow_at)
+					rehash(0);
+			}
+
+			//At least n slots, and enough for size() under max_load_factor()
+			void	rehash(size_type n)
+			{
+				const size_type cap = _round_capacity(std::max(n, _min_capacity_for(_count)));
+
+				if (cap != _capacity && (_count != 0 || n != 0))
+					_rehash_to(cap);
+			}
+
+			void	reserve(size_type n)
+			{
+				if (n > _grow_at)
+					_rehash_to(_round_capacity(std::max(_min_capacity_for(n), _capacity)));
+			}
+
+			//Operations
+			iterator	find(const key_type &k)
+			{ return (_iterator(_find_index(k))); }
+
+			const_iterator	find(const key_type &k) const
+			{ return (_iterator(_find_index(k))); }
+
+			size_type	count(const key_type &k) const
+			{ return (_find_index(k) == _capacity ? 0 : 1); }
+
+			ft::pair<iterator, iterator>	equal_range(const key_type &k)
+			{
+				iterator first = find(k);
+				iterator last = first;
+
+				if (first != end())
+					++last;
+				return (ft::pair<iterator, iterator>(first, last));
+			}
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+			{
+				const_iterator first = find(k);
+				const_iterator last = first;
+
+				if (first != end())
+					++last;
+				return (ft::pair<const_iterator, const_iterator>(first, last));
+			}
+
+			//insert
+			ft::pair<iterator, bool>	insert_unique(const value_type &val)
+			{
+				size_type i = _find_index(_key(val));
+
+				if (i != _capacity)
+					return (ft::pair<iterator, bool>(_iterator(i), false));
+				if (_count + 1 > _grow_at)
+					_rehash_to(_round_capacity(std::max(_min_capacity_for(_count + 1), _capacity * 2)));
+				while ((i = _insert_new(val)) == _capacity)
+					_rehash_to(_capacity * 2);
+				return (ft::pair<iterator, bool>(_iterator(i), true));
+			}
+
+			template<typename Iterator>
+			void	insert_unique(Iterator first, Iterator last)
+			{
+				for (; first != last; ++first)
+					insert_unique(*first);
+			}
+
+			//erase
+			void	erase(const_iterator position)
+			{ _erase_index(position.slot - _slots); }
+
+			size_type	erase(const key_type &k)
+			{
+				size_type i = _find_index(k);
+
+				if (i == _capacity)
+					return (0);
+				_erase_index(i);
+				return (1);
+			}
+
+			//Erasure moves elements around: the keys of the range are
+			//collected first
+			void	erase(const_iterator first, const_iterator last)
+			{
+				if (first == begin() && last == end())
+				{
+					clear();
+					return ;
+				}
+				ft::vector<key_type, typename Alloc::template rebind<key_type>::other>	keys;
+
+				for (; first != last; ++first)
+					keys.push_back(_key(*first));
+				for (size_type i = 0; i < keys.size(); ++i)
+					erase(keys[i]);
+			}
+
+			//Keeps the buckets, like std::unordered_map
+			void	clear()
+			{ _destroy_all(); }
+
+			void	swap(Hashtable &x)
+			{
+				std::swap(_alloc, x._alloc);
+				std::swap(_meta_alloc, x._meta_alloc);
+				std::swap(_hash, x._hash);
+				std::swap(_eq, x._eq);
+				std::swap(_slots, x._slots);
+				std::swap(_meta, x._meta);
+				std::swap(_capacity, x._capacity);
+				std::swap(_shift, x._shift);
+				std::swap(_count, x._count);
+				std::swap(_grow_at, x._grow_at);
+				std::swap(_max_load, x._max_load);
+			}
+	};
+	//Operators
+	template<typename Key, typename Val, typename KeyOfValue, typename Hash, typename Pred, typename Alloc>
+	inline	bool	operator==(const Hashtable<Key, Val, KeyOfValue, Hash, Pred, Alloc> &x,
+	const Hashtable<Key, Val, KeyOfValue, Hash, Pred, Alloc> &y)
+	{
+		typedef typename Hashtable<Key, Val, KeyOfValue, Hash, Pred, Alloc>::const_iterator	const_iterator;
+
+		if (x.size() != y.size())
+			return (false);
+		for (const_iterator it = x.begin(); it != x.end(); ++it)
+		{
+			const_iterator found = y.find(KeyOfValue()(*it));
+
+			if (found == y.end() || !(*found == *it))
+				return (false);
+		}
+		return (true);
+	}
+}
+#endif
@@ -0,0 +1,201 @@
+#ifndef FT_MONOTONIC_ALLOCATOR_HPP
+# define FT_MONOTONIC_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+
+namespace ft
+{
+	//BUMP ALLOCATOR FOR SHORT-LIVED CONTAINERS
+	//Hands out memory from a caller-provided buffer, then from heap blocks
+	//twice as big as the previous one. Nothing is given back before release(),
+	//which frees every heap block at once and rewinds to the buffer: build the
+	//containers of a request on one arena, destroy them, release it. Not
+	//thread-safe, not copyable (allocators only keep a pointer to it).
+	class arena
+	{
+		public:
+			enum
+			{
+				max_align = 16,
+				default_block_size = 4096,
+				max_block_size = 1024 * 1024,
+				block_header = max_align
+			};
+
+		private:
+			struct Block
+			{ Block	*next; };
+
+			Block	*_blocks;
+			char	*_buffer;
+			size_t	_buffer_size;
+			char	*_cur;
+			char	*_end;
+			size_t	_next_size;
+			size_t	_first_size;
+
+			arena(const arena &);
+			arena	&operator=(const arena &);
+
+			static char	*_align_up(char *p, size_t align)
+			{ return (reinterpret_cast<char*>((reinterpret_cast<size_t>(p) + align - 1) & ~(align - 1))); }
+
+			//Room for n bytes at any alignment up to align, in a block at least
+			//as big as the next step of the geometric growth
+			void	_new_block(size_t n, size_t align)
+			{
+				size_t	size = _next_size;
+
+				if (size - block_header < n + align)
+					size = n + align + block_header;
+				Block *block = static_cast<Block*>(::operator new(size));
+
+				block->next = _blocks;
+				_blocks = block;
+				_cur = reinterpret_cast<char*>(block) + block_header;
+				_end = reinterpret_cast<char*>(block) + size;
+				if (_next_size < max_block_size)
+					_next_size *= 2;
+			}
+
+		public:
+			//Heap blocks only, the first one of block_size bytes
+			explicit arena(size_t block_size = default_block_size)
+				: _blocks(0), _buffer(0), _buffer_size(0), _cur(0), _end(0),
+				_next_size(block_size < 2 * block_header ? 2 * block_header : block_size),
+				_first_size(_next_size) {}
+
+			//Serves from buffer (often on the stack) until it is full. The
+			//buffer must outlive the arena
+			arena(void *buffer, size_t size, size_t block_size = default_block_size)
+				: _blocks(0), _buffer(static_cast<char*>(buffer)), _buffer_size(size),
+				_cur(_buffer), _end(_buffer + size),
+				_next_size(block_size < 2 * block_header ? 2 * block_header : block_size),
+				_first_size(_next_size) {}
+
+			~arena()
+			{ release(); }
+
+			//Throws std::bad_alloc when n plus the alignment and the block
+			//header does not fit in a size_t
+			void	*allocate(size_t n, size_t align = max_align)
+			{
+				if (n > size_t(-1) - align - block_header)
+					throw std::bad_alloc();
+				char	*p = _align_up(_cur, align);
+
+				if (_cur == 0 || static_cast<size_t>(_end - _cur) < n + (p - _cur))
+				{
+					_new_block(n, align);
+					p = _align_up(_cur, align);
+				}
+				_cur = p + n;
+				return (p);
+			}
+
+			//Frees all heap blocks; everything allocated from the arena is gone,
+			//the containers using it must already be destroyed
+			void	release()
+			{
+				while (_blocks != 0)
+				{
+					Block *next = _blocks->next;
+					::operator delete(_blocks);
+					_blocks = next;
+				}
+				_cur = _buffer;
+				_end = _buffer + _buffer_size;
+				_next_size = _first_size;
+			}
+	};
+
+	//Allocator over an arena: deallocate() does nothing, the memory comes
+	//back with arena::release(). Elements are still destroyed by their
+	//containers. Copies and rebinds share the arena, and allocators compare
+	//equal when they share it. A vector that grows leaves its old blocks in
+	//the arena, reserve() first when the size is known
+	template<typename T>
+	class monotonic_allocator
+	{
+		template<typename U>
+		friend class monotonic_allocator;
+
+		public:
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef const T*	const_pointer;
+			typedef T&			reference;
+			typedef const T&	const_reference;
+			typedef size_t		size_type;
+			typedef ptrdiff_t	difference_type;
+
+			template<typename U>
+			struct rebind
+			{ typedef monotonic_allocator<U> other; };
+
+		private:
+			arena	*_arena;
+
+			//The alignment of T divides sizeof(T), so does its lowest set bit
+			static size_t	_align()
+			{
+				const size_t	low_bit = sizeof(T) & (~sizeof(T) + 1);
+
+				return (low_bit < size_t(arena::max_align) ? low_bit : size_t(arena::max_align));
+			}
+
+		public:
+			monotonic_allocator(arena &a) throw() : _arena(&a) {}
+
+			monotonic_allocator(const monotonic_allocator &src) throw() : _arena(src._arena) {}
+
+			template<typename U>
+			monotonic_allocator(const monotonic_allocator<U> &src) throw() : _arena(src._arena) {}
+
+			monotonic_allocator	&operator=(const monotonic_allocator &src)
+			{
+				_arena = src._arena;
+				return (*this);
+			}
+
+			arena	&resource() const
+			{ return (*_arena); }
+
+			pointer	address(reference x) const
+			{ return (&x); }
+
+			const_pointer	address(const_reference x) const
+			{ return (&x); }
+
+			pointer	allocate(size_type n, const void * = 0)
+			{
+				if (n > max_size())
+					throw std::bad_alloc();
+				return (static_cast<pointer>(_arena->allocate(n * sizeof(T), _align())));
+			}
+
+			void	deallocate(pointer, size_type)
+			{}
+
+			//What the arena can serve at the largest alignment
+			size_type	max_size() const throw()
+			{ return ((size_t(-1) - arena::max_align - arena::block_header) / sizeof(T)); }
+
+			void	construct(pointer p, const T &val)
+			{ ::new(static_cast<void*>(p)) T(val); }
+
+			void	destroy(pointer p)
+			{ p->~T(); }
+
+			template<typename U>
+			bool	operator==(const monotonic_allocator<U> &x) const
+			{ return (_arena == x._arena); }
+
+			template<typename U>
+			bool	operator!=(const monotonic_allocator<U> &x) const
+			{ return (_arena != x._arena); }
+	};
+}
+
+#endif
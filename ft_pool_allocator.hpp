@@ -0,0 +1,240 @@
+#ifndef FT_POOL_ALLOCATOR_HPP
+# define FT_POOL_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+
+namespace ft
+{
+	//SLAB STORAGE SHARED BY ALL COPIES (AND REBINDS) OF A POOL_ALLOCATOR
+	//Single objects are carved out of big chunks and recycled through one free
+	//list per slot size. Chunks are only given back to the system in bulk: when
+	//the last object is returned (clear() of the container) or when the last
+	//allocator referencing the pool goes away. Not thread-safe.
+	class Pool_resource
+	{
+		public:
+			enum
+			{
+				slot_align = 8,
+				max_slot = 256,
+				chunk_size = 64 * 1024,
+				chunk_header = 16
+			};
+
+		private:
+			struct Free_slot
+			{ Free_slot	*next; };
+
+			struct Chunk
+			{ Chunk	*next; };
+
+			Chunk		*_chunks;
+			Free_slot	*_free[max_slot / slot_align];
+			char		*_cur;
+			char		*_end;
+			size_t		_refs;
+			size_t		_live;
+
+			Pool_resource(const Pool_resource &);
+			Pool_resource	&operator=(const Pool_resource &);
+
+			static size_t	_slot_size(size_t n)
+			{ return ((n + slot_align - 1) & ~size_t(slot_align - 1)); }
+
+			void	_new_chunk()
+			{
+				Chunk *chunk = static_cast<Chunk*>(::operator new(chunk_size));
+
+				chunk->next = _chunks;
+				_chunks = chunk;
+				_cur = reinterpret_cast<char*>(chunk) + chunk_header;
+				_end = reinterpret_cast<char*>(chunk) + chunk_size;
+			}
+
+			//Keep the newest chunk so a container oscillating around empty
+			//does not hit malloc on every insert
+			void	_release_all_but_one()
+			{
+				if (_chunks == 0)
+					return ;
+				Chunk *x = _chunks->next;
+
+				while (x != 0)
+				{
+					Chunk *next = x->next;
+					::operator delete(x);
+					x = next;
+				}
+				_chunks->next = 0;
+				_cur = reinterpret_cast<char*>(_chunks) + chunk_header;
+				_end = reinterpret_cast<char*>(_chunks) + chunk_size;
+				for (size_t i = 0; i < max_slot / slot_align; ++i)
+					_free[i] = 0;
+			}
+
+		public:
+			Pool_resource() : _chunks(0), _cur(0), _end(0), _refs(1), _live(0)
+			{
+				for (size_t i = 0; i < max_slot / slot_align; ++i)
+					_free[i] = 0;
+			}
+
+			~Pool_resource()
+			{
+				while (_chunks != 0)
+				{
+					Chunk *next = _chunks->next;
+					::operator delete(_chunks);
+					_chunks = next;
+				}
+			}
+
+			void	*allocate(size_t n)
+			{
+				const size_t	size = _slot_size(n);
+				Free_slot		*&head = _free[size / slot_align - 1];
+				void			*p;
+
+				if (head != 0)
+				{
+					p = head;
+					head = head->next;
+				}
+				else
+				{
+					//Slots whose size is a multiple of 16 may hold 16-aligned types
+					if (size % 16 == 0 && reinterpret_cast<size_t>(_cur) % 16 != 0)
+						_cur += slot_align;
+					if (_cur == 0 || _end - _cur < static_cast<ptrdiff_t>(size))
+						_new_chunk();
+					p = _cur;
+					_cur += size;
+				}
+				++_live;
+				return (p);
+			}
+
+			void	deallocate(void *p, size_t n)
+			{
+				Free_slot	*&head = _free[_slot_size(n) / slot_align - 1];
+				Free_slot	*slot = static_cast<Free_slot*>(p);
+
+				slot->next = head;
+				head = slot;
+				if (--_live == 0)
+					_release_all_but_one();
+			}
+
+			void	retain()
+			{ ++_refs; }
+
+			//Returns true when the caller must delete the resource
+			bool	release()
+			{ return (--_refs == 0); }
+	};
+
+	template<typename T>
+	class pool_allocator
+	{
+		template<typename U>
+		friend class pool_allocator;
+
+		public:
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef const T*	const_pointer;
+			typedef T&			reference;
+			typedef const T&	const_reference;
+			typedef size_t		size_type;
+			typedef ptrdiff_t	difference_type;
+
+			template<typename U>
+			struct rebind
+			{ typedef pool_allocator<U> other; };
+
+		private:
+			//Created with the allocator and shared by all its copies and
+			//rebinds, so two allocators compare equal for their whole life
+			//exactly when nodes may travel between their containers
+			Pool_resource	*_pool;
+
+			static bool	_pooled(size_type n)
+			{ return (n == 1 && sizeof(T) <= Pool_resource::max_slot); }
+
+			void	_release()
+			{
+				if (_pool->release())
+					delete _pool;
+			}
+
+		public:
+			//Only the resource itself, chunks come with the first allocation
+			pool_allocator() : _pool(new Pool_resource()) {}
+
+			pool_allocator(const pool_allocator &src) throw() : _pool(src._pool)
+			{ _pool->retain(); }
+
+			template<typename U>
+			pool_allocator(const pool_allocator<U> &src) throw() : _pool(src._pool)
+			{ _pool->retain(); }
+
+			~pool_allocator()
+			{ _release(); }
+
+			pool_allocator	&operator=(const pool_allocator &src)
+			{
+				if (_pool != src._pool)
+				{
+					src._pool->retain();
+					_release();
+					_pool = src._pool;
+				}
+				return (*this);
+			}
+
+			pointer	address(reference x) const
+			{ return (&x); }
+
+			const_pointer	address(const_reference x) const
+			{ return (&x); }
+
+			pointer	allocate(size_type n, const void * = 0)
+			{
+				if (_pooled(n))
+					return (static_cast<pointer>(_pool->allocate(sizeof(T))));
+				if (n > max_size())
+					throw std::bad_alloc();
+				return (static_cast<pointer>(::operator new(n * sizeof(T))));
+			}
+
+			void	deallocate(pointer p, size_type n)
+			{
+				if (_pooled(n))
+					_pool->deallocate(p, sizeof(T));
+				else
+					::operator delete(p);
+			}
+
+			size_type	max_size() const throw()
+			{ return (size_t(-1) / sizeof(T)); }
+
+			void	construct(pointer p, const T &val)
+			{ ::new(static_cast<void*>(p)) T(val); }
+
+			void	destroy(pointer p)
+			{ p->~T(); }
+
+			//Two allocators are equal when they share a pool, so nodes may
+			//only travel between containers built from the same allocator
+			template<typename U>
+			bool	operator==(const pool_allocator<U> &x) const
+			{ return (_pool == x._pool); }
+
+			template<typename U>
+			bool	operator!=(const pool_allocator<U> &x) const
+			{ return (_pool != x._pool); }
+	};
+}
+
+#endif
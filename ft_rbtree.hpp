@@ -4,48 +4,110 @@
 # include <algorithm>
 # include <iterator>
 # include <memory>
+# include <new>
 # include "ft_iterator.hpp"
 # include "ft_pair.hpp"
 # include "ft_utilities.hpp"
 
+//Define FT_RB_TREE_ORDER_STATISTICS before including to store subtree sizes in
+//the nodes: map and set then get rank(), select(), count_range() and
+//size(first, last) in O(log n), at the cost of one word per node
+//Define FT_RB_TREE_COMPACT_NODE to keep the color in the low bit of the parent
+//pointer and the value last: no color word, no padding after small values
 namespace ft
 {
 	enum Rb_tree_color{ red = false, black = true};
 
-	template<typename Value>
-	struct Rb_tree_node
+	//Links, color (and subtree size) of a node, with nothing that depends on
+	//the value: rebalancing and traversal below work on this type only, so
+	//every tree instantiation shares one copy of them. Links and color are
+	//only reached through the accessors, so the layout can change
+	struct Rb_tree_node_base
 	{
-		typedef Rb_tree_node*		node_ptr;
-		typedef const Rb_tree_node*	const_node_ptr;
+		typedef Rb_tree_node_base*			base_ptr;
+		typedef const Rb_tree_node_base*	const_base_ptr;
+
+# ifdef FT_RB_TREE_COMPACT_NODE
+		base_ptr		parent_color; //Nodes are word aligned, bit 0 is free
+		base_ptr		left;
+		base_ptr		right;
+#  ifdef FT_RB_TREE_ORDER_STATISTICS
+		size_t			size;
+#  endif
+
+		base_ptr	get_parent() const
+		{ return (reinterpret_cast<base_ptr>(reinterpret_cast<size_t>(parent_color) & ~size_t(1))); }
+
+		void	set_parent(base_ptr p)
+		{
+			parent_color = reinterpret_cast<base_ptr>(reinterpret_cast<size_t>(p)
+				| (reinterpret_cast<size_t>(parent_color) & 1));
+		}
+
+		Rb_tree_color	get_color() const
+		{ return (Rb_tree_color(reinterpret_cast<size_t>(parent_color) & 1)); }
+
+		void	set_color(Rb_tree_color c)
+		{
+			parent_color = reinterpret_cast<base_ptr>((reinterpret_cast<size_t>(parent_color)
+				& ~size_t(1)) | size_t(c));
+		}
 
-		node_ptr		parent;
-		node_ptr		left;
-		node_ptr		right;
-		Value			value;
+		//The parent link as an lvalue, for a red node only (the header,
+		//whose parent is the root): red is bit 0 clear
+		base_ptr	&red_parent()
+		{ return (parent_color); }
+# else
+		base_ptr		parent;
+		base_ptr		left;
+		base_ptr		right;
+#  ifdef FT_RB_TREE_ORDER_STATISTICS
+		size_t			size;
+#  endif
 		Rb_tree_color	color;
 
-		static node_ptr	minimum(node_ptr x)
+		base_ptr	get_parent() const
+		{ return (parent); }
+
+		void	set_parent(base_ptr p)
+		{ parent = p; }
+
+		Rb_tree_color	get_color() const
+		{ return (color); }
+
+		void	set_color(Rb_tree_color c)
+		{ color = c; }
+
+		base_ptr	&red_parent()
+		{ return (parent); }
+# endif
+
+		//Not a POD: a value smaller than a word can then sit in the padding
+		//after color instead of after the whole base
+		Rb_tree_node_base() {}
+
+		static base_ptr	minimum(base_ptr x)
 		{
 			while (x->left != 0)
 				x = x->left;
 			return (x);
 		}
 
-		static node_ptr	maximum(node_ptr x)
+		static base_ptr	maximum(base_ptr x)
 		{
 			while (x->right != 0)
 				x = x->right;
 			return (x);
 		}
 
-		static const_node_ptr	minimum(const_node_ptr x)
+		static const_base_ptr	minimum(const_base_ptr x)
 		{
 			while (x->left != 0)
 				x = x->left;
 			return (x);
 		}
 
-		static const_node_ptr	maximum(const_node_ptr x)
+		static const_base_ptr	maximum(const_base_ptr x)
 		{
 			while (x->right != 0)
 				x = x->right;
@@ -53,8 +115,22 @@ namespace ft
 		}
 	};
 
-	template<typename T>
-	Rb_tree_node<T>	*node_increment(Rb_tree_node<T> *x)
+	//Nodes are allocated raw and only their value is constructed
+	template<typename Value>
+	struct Rb_tree_node : public Rb_tree_node_base
+	{
+		typedef Rb_tree_node*		link_type;
+		typedef const Rb_tree_node*	const_link_type;
+
+		Value	value;
+	};
+
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+	inline size_t	rb_tree_size(const Rb_tree_node_base *x)
+	{ return (x == 0 ? 0 : x->size); }
+# endif
+
+	inline Rb_tree_node_base	*node_increment(Rb_tree_node_base *x)
 	{
 		if (x->right != 0)
 		{
@@ -64,12 +140,12 @@ namespace ft
 		}
 		else
 		{
-			Rb_tree_node<T>	*y = x->parent;
+			Rb_tree_node_base	*y = x->get_parent();
 
 			while (x == y->right)
 			{
 				x = y;
-				y = y->parent;
+				y = y->get_parent();
 			}
 			if (x->right != y)
 				x = y;
@@ -77,10 +153,11 @@ namespace ft
 		return x;
 	}
 
-	template<typename T>
-	Rb_tree_node<T>	*node_decrement(Rb_tree_node<T> *x)
+	//The header is the only red node whose grandparent is itself (its
+	//parent is the root): decrementing end() gives the rightmost node
+	inline Rb_tree_node_base	*node_decrement(Rb_tree_node_base *x)
 	{
-		if (x->color == ft::red && x->parent->parent == x)
+		if (x->get_color() == ft::red && x->get_parent()->get_parent() == x)
 			x = x->right;
 		else if (x->left != 0)
 		{
@@ -90,26 +167,445 @@ namespace ft
 		}
 		else
 		{
-			Rb_tree_node<T>	*y;
+			Rb_tree_node_base	*y;
 
-			y = x->parent;
+			y = x->get_parent();
 			while (x == y->left)
 			{
 				x = y;
-				y = y->parent;
+				y = y->get_parent();
 			}
 			x = y;
 		}
 		return x;
 	}
 
-	template<typename T>
-	const Rb_tree_node<T>	*node_decrement(const Rb_tree_node<T> *x)
-	{ return (node_decrement(const_cast<Rb_tree_node<T>* >(x))); }
+	inline const Rb_tree_node_base	*node_decrement(const Rb_tree_node_base *x)
+	{ return (node_decrement(const_cast<Rb_tree_node_base*>(x))); }
 
-	template<typename T>
-	const Rb_tree_node<T>	*node_increment(const Rb_tree_node<T> *x)
-	{ return (node_increment(const_cast<Rb_tree_node<T>* >(x))); }
+	inline const Rb_tree_node_base	*node_increment(const Rb_tree_node_base *x)
+	{ return (node_increment(const_cast<Rb_tree_node_base*>(x))); }
+
+	//REBALANCING, shared by every tree
+	inline void	rb_tree_rotate_left(Rb_tree_node_base *const x, Rb_tree_node_base *&root)
+	{
+		Rb_tree_node_base *const y = x->right;
+
+		x->right = y->left;
+		if(y->left != 0)
+			y->left->set_parent(x);
+		y->set_parent(x->get_parent());
+		if (x == root)
+			root = y;
+		else if (x == x->get_parent()->left)
+			x->get_parent()->left = y;
+		else
+			x->get_parent()->right = y;
+		y->left = x;
+		x->set_parent(y);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+		y->size = x->size;
+		x->size = rb_tree_size(x->left) + rb_tree_size(x->right) + 1;
+# endif
+	}
+
+	inline void	rb_tree_rotate_right(Rb_tree_node_base *const x, Rb_tree_node_base *&root)
+	{
+		Rb_tree_node_base *const y = x->left;
+
+		x->left = y->right;
+		if (y->right != 0)
+			y->right->set_parent(x);
+		y->set_parent(x->get_parent());
+		if (x == root)
+			root = y;
+		else if (x->get_parent()->left == x)
+			x->get_parent()->left = y;
+		else
+			x->get_parent()->right = y;
+		y->right = x;
+		x->set_parent(y);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+		y->size = x->size;
+		x->size = rb_tree_size(x->left) + rb_tree_size(x->right) + 1;
+# endif
+	}
+
+	inline void	rb_tree_colorflip(Rb_tree_node_base *&x, Rb_tree_node_base *const x_uncle, Rb_tree_node_base *const x_gp)
+	{
+		x->get_parent()->set_color(ft::black);
+		x_uncle->set_color(ft::black);
+		x_gp->set_color(ft::red);
+		x = x_gp;
+	}
+
+	//Restores the red-black properties above the red node x, root may
+	//be the root of a detached subtree. Does not blacken the root
+	inline void	rb_tree_insert_fixup(Rb_tree_node_base *x, Rb_tree_node_base *&root)
+	{
+		while (x != root && x->get_parent()->get_color() == ft::red)
+		{
+			Rb_tree_node_base *const x_gp =  x->get_parent()->get_parent();
+			if (x->get_parent() == x_gp->left) //if xparent is leftchild
+			{
+				Rb_tree_node_base *const x_uncle = x_gp->right;
+
+				if (x_uncle && x_uncle->get_color() == ft::red)
+					rb_tree_colorflip(x, x_uncle, x_gp);
+				else
+				{
+					if (x == x->get_parent()->right)
+					{
+						x = x->get_parent();
+						rb_tree_rotate_left(x, root);
+					}
+					x->get_parent()->set_color(ft::black); //uncle is already black
+					x_gp->set_color(ft::red);
+					rb_tree_rotate_right(x_gp, root);
+				}
+			}
+			else // xparent is rightchild
+			{
+				Rb_tree_node_base *const x_uncle = x_gp->left;
+
+				if (x_uncle && x_uncle->get_color() == ft::red)
+					rb_tree_colorflip(x, x_uncle, x_gp);
+				else
+				{
+					if (x == x->get_parent()->left)
+					{
+						x = x->get_parent();
+						rb_tree_rotate_right(x, root);
+					}
+					x->get_parent()->set_color(ft::black); //uncle is already black
+					x_gp->set_color(ft::red);
+					rb_tree_rotate_left(x_gp, root);
+				}
+			}
+		}
+	}
+
+	//Links the new node x as a child of p (left one if insert_left) then
+	//rebalances, header keeps the root, leftmost and rightmost up to date
+	inline void	rb_tree_insert_and_rebalance(const bool insert_left, Rb_tree_node_base *x, Rb_tree_node_base *p,
+		Rb_tree_node_base &header)
+	{
+		Rb_tree_node_base	*&root = header.red_parent();
+
+		//Init node
+		x->set_parent(p);
+		x->left = 0;
+		x->right = 0;
+		x->set_color(ft::red);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+		x->size = 1;
+		for (Rb_tree_node_base *y = p; y != &header; y = y->get_parent())
+			++y->size;
+# endif
+		//Insert
+		if (insert_left)
+		{
+			p->left = x;
+			if (p == &header)
+			{
+				root = x;
+				header.right = x;
+			}
+			else if (p == header.left)
+				header.left = x;
+		}
+		else
+		{
+			p->right = x;
+			if (p == header.right)
+				header.right = x;
+		}
+		//Rebalance
+		rb_tree_insert_fixup(x, root);
+		root->set_color(ft::black);
+	}
+
+	inline bool	rb_tree_is_black(const Rb_tree_node_base *x)
+	{ return (x == 0 || x->get_color() == ft::black); }
+
+	//Unlinks z and rebalances, z is returned to be freed
+	inline Rb_tree_node_base	*rb_tree_rebalance_for_erase(Rb_tree_node_base *const z, Rb_tree_node_base &header)
+	{
+		Rb_tree_node_base *&root = header.red_parent();
+		Rb_tree_node_base *&leftmost = header.left;
+		Rb_tree_node_base *&rightmost = header.right;
+		Rb_tree_node_base *y = z; //el to navigate;
+		Rb_tree_node_base *x = 0; //to find child
+		Rb_tree_node_base *x_parent = 0;
+
+		if (y->left == 0)
+			x = y->right;
+		else
+		{
+			if (y->right == 0)
+				x = y->left;
+			else
+			{
+				y = y->right;
+				while (y->left) //find successor;
+					y = y->left;
+				x = y->right; //child successor
+			}
+		}
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+		//y is the node leaving its place, every ancestor loses one
+		for (Rb_tree_node_base *p = y->get_parent(); p != &header; p = p->get_parent())
+			--p->size;
+# endif
+		if (y != z) //relink y(successor) to z;
+		{
+			z->left->set_parent(y); //link succesor with z left child
+			y->left = z->left;  // same
+			if (y != z->right) //if successor is not z right
+			{
+				x_parent = y->get_parent();
+				if (x)
+					x->set_parent(y->get_parent());
+				y->get_parent()->left = x;
+				y->right = z->right;
+				z->right->set_parent(y);
+			}
+			else
+				x_parent = y;
+			if (root == z)
+				root = y;
+			else if (z->get_parent()->left == z)
+				z->get_parent()->left = y;
+			else
+				z->get_parent()->right = y;
+			y->set_parent(z->get_parent());
+			const Rb_tree_color	color = y->get_color();
+
+			y->set_color(z->get_color());
+			z->set_color(color);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+			y->size = z->size;
+# endif
+			y = z;
+		}
+		else
+		{
+			x_parent = y->get_parent();
+			if (x)
+				x->set_parent(y->get_parent());
+			if (root == z)
+				root = x;
+			else
+			{	//make z parent point to x;
+				if (z->get_parent()->left == z)
+					z->get_parent()->left = x;
+				else
+					z->get_parent()->right = x;
+			}
+			if (leftmost == z)
+			{
+				if (z->right == 0)
+					leftmost = z->get_parent();
+				else
+					leftmost = Rb_tree_node_base::minimum(x);
+			}
+			if (rightmost == z)
+			{
+				if (z->left == 0)
+					rightmost = z->get_parent();
+				else
+					rightmost = Rb_tree_node_base::maximum(x);
+			}
+		}
+		if (y->get_color() != ft::red)
+		{
+			while (x != root && rb_tree_is_black(x))
+			{
+				if (x == x_parent->left)
+				{
+					Rb_tree_node_base *w = x_parent->right;
+					if (w->get_color() == ft::red)
+					{
+						w->set_color(ft::black);
+						x_parent->set_color(ft::red);
+						rb_tree_rotate_left(x_parent, root);
+						w = x_parent->right;
+					}
+					if (rb_tree_is_black(w->left) && rb_tree_is_black(w->right))
+					{
+						w->set_color(ft::red);
+						x = x_parent;
+						x_parent = x_parent->get_parent();
+					}
+					else
+					{
+						if (rb_tree_is_black(w->right))
+						{
+							w->left->set_color(ft::black);
+							w->set_color(ft::red);
+							rb_tree_rotate_right(w, root);
+							w = x_parent->right;
+						}
+						w->set_color(x_parent->get_color());
+						x_parent->set_color(ft::black);
+						if (w->right)
+							w->right->set_color(ft::black);
+						rb_tree_rotate_left(x_parent, root);
+						break;
+					}
+				}
+				else
+				{
+					Rb_tree_node_base *w = x_parent->left;
+					if (w->get_color() == ft::red)
+					{
+						w->set_color(ft::black);
+						x_parent->set_color(ft::red);
+						rb_tree_rotate_right(x_parent, root);
+						w = x_parent->left;
+					}
+					if (rb_tree_is_black(w->right) && rb_tree_is_black(w->left))
+					{
+						w->set_color(ft::red);
+						x = x_parent;
+						x_parent = x_parent->get_parent();
+					}
+					else
+					{
+						if (rb_tree_is_black(w->left))
+						{
+							w->right->set_color(ft::black);
+							w->set_color(ft::red);
+							rb_tree_rotate_left(w, root);
+							w = x_parent->left;
+						}
+						w->set_color(x_parent->get_color());
+						x_parent->set_color(ft::black);
+						if (w->left)
+							w->left->set_color(ft::black);
+						rb_tree_rotate_right(x_parent, root);
+						break;
+					}
+				}
+			}
+			if (x)
+				x->set_color(ft::black);
+		}
+		return (y);
+	}
+
+	//Split and join helpers, subtrees are handled as detached roots (parent 0)
+	//together with their black height
+
+	//Black nodes on the path from x to a leaf, x included
+	inline size_t	rb_tree_black_height(const Rb_tree_node_base *x)
+	{
+		size_t h = 0;
+
+		for (; x != 0; x = x->left)
+		{
+			if (x->get_color() == ft::black)
+				++h;
+		}
+		return (h);
+	}
+
+	//Links left < k < right in O(|hl - hr| + 1): k is hung on the spine
+	//of the higher tree at the node of matching black height and the
+	//red violation is repaired upward. h gets the result black height
+	inline Rb_tree_node_base	*rb_tree_join(Rb_tree_node_base *left, Rb_tree_node_base *k, Rb_tree_node_base *right, size_t hl, size_t hr, size_t &h)
+	{
+		Rb_tree_node_base	*root;
+		Rb_tree_node_base	*c;
+		Rb_tree_node_base	*p = 0;
+		size_t	ch;
+
+		if (left)
+		{
+			left->set_parent(0);
+			if (left->get_color() == ft::red)
+			{
+				left->set_color(ft::black);
+				++hl;
+			}
+		}
+		if (right)
+		{
+			right->set_parent(0);
+			if (right->get_color() == ft::red)
+			{
+				right->set_color(ft::black);
+				++hr;
+			}
+		}
+		if (hl == hr)
+		{
+			k->set_parent(0);
+			k->left = left;
+			k->right = right;
+			k->set_color(ft::black);
+			if (left)
+				left->set_parent(k);
+			if (right)
+				right->set_parent(k);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+			k->size = rb_tree_size(left) + rb_tree_size(right) + 1;
+# endif
+			h = hl + 1;
+			return (k);
+		}
+		if (hl > hr)
+		{
+			root = left;
+			c = left;
+			ch = hl;
+			while (!(rb_tree_is_black(c) && ch == hr))
+			{
+				if (rb_tree_is_black(c))
+					--ch;
+				p = c;
+				c = c->right;
+			}
+			p->right = k;
+			k->left = c;
+			k->right = right;
+		}
+		else
+		{
+			root = right;
+			c = right;
+			ch = hr;
+			while (!(rb_tree_is_black(c) && ch == hl))
+			{
+				if (rb_tree_is_black(c))
+					--ch;
+				p = c;
+				c = c->left;
+			}
+			p->left = k;
+			k->left = left;
+			k->right = c;
+		}
+		k->set_parent(p);
+		k->set_color(ft::red);
+		if (k->left)
+			k->left->set_parent(k);
+		if (k->right)
+			k->right->set_parent(k);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+		k->size = rb_tree_size(k->left) + rb_tree_size(k->right) + 1;
+		for (Rb_tree_node_base *y = p; y != 0; y = y->get_parent())
+			y->size = rb_tree_size(y->left) + rb_tree_size(y->right) + 1;
+# endif
+		rb_tree_insert_fixup(k, root);
+		h = std::max(hl, hr);
+		if (root->get_color() == ft::red)
+		{
+			root->set_color(ft::black);
+			++h;
+		}
+		return (root);
+	}
 
 	template<typename T>
 	struct	Rb_tree_iterator
@@ -121,8 +617,9 @@ namespace ft
 		typedef std::bidirectional_iterator_tag	iterator_category;
 		typedef ptrdiff_t						difference_type;
 
-		typedef Rb_tree_iterator<T>					self;
-		typedef typename Rb_tree_node<T>::node_ptr	node_ptr;
+		typedef Rb_tree_iterator<T>				self;
+		typedef Rb_tree_node_base::base_ptr		node_ptr;
+		typedef Rb_tree_node<T>*				link_type;
 
 		node_ptr	node;
 
@@ -131,10 +628,10 @@ namespace ft
 		explicit Rb_tree_iterator(node_ptr x) : node(x){}
 
 		reference	operator*() const
-		{ return (node->value); }
+		{ return (static_cast<link_type>(node)->value); }
 
 		pointer	operator->() const
-		{ return &(node->value); }
+		{ return &(static_cast<link_type>(node)->value); }
 
 		self	&operator++()
 		{
@@ -181,8 +678,9 @@ namespace ft
 		typedef std::bidirectional_iterator_tag	iterator_category;
 		typedef ptrdiff_t						difference_type;
 
-		typedef Const_rb_tree_iterator<T>					self;
-		typedef typename Rb_tree_node<T>::const_node_ptr	node_ptr;
+		typedef Const_rb_tree_iterator<T>			self;
+		typedef Rb_tree_node_base::const_base_ptr	node_ptr;
+		typedef const Rb_tree_node<T>*				link_type;
 
 		node_ptr	node;
 
@@ -196,10 +694,10 @@ namespace ft
 		{ return iterator(const_cast<typename iterator::node_ptr>(node)); }
 
 		reference	operator*() const
-		{ return (node->value); }
+		{ return (static_cast<link_type>(node)->value); }
 
 		pointer	operator->() const
-		{ return &(node->value); }
+		{ return &(static_cast<link_type>(node)->value); }
 
 		self	&operator++()
 		{
@@ -234,13 +732,169 @@ namespace ft
 		{ return (node != x.node); }
 	};
 
+	//Owns a node unlinked by Rb_tree::extract() until it is inserted again
+	//(possibly in another tree) or the handle dies. There is no move in C++98:
+	//like std::auto_ptr, copying a handle transfers the node. The allocator
+	//is held in raw storage and only built from a tree's, so a default
+	//constructed (empty) handle works with allocators that have no default
+	//constructor
+	template<typename Key, typename Value, typename KeyOfValue, typename NodeAlloc, typename Alloc>
+	class Rb_tree_node_handle
+	{
+		template<typename K, typename V, typename KoV, typename C, typename A>
+		friend class Rb_tree;
+
+		public:
+			typedef Key		key_type;
+			typedef Value	value_type;
+			typedef Alloc	allocator_type;
+
+		private:
+			typedef typename Rb_tree_node<Value>::link_type	node_ptr;
+
+			union Alloc_storage
+			{
+				char		bytes[sizeof(NodeAlloc)];
+				long double	align_ld;
+				long long	align_ll;
+				void		*align_p;
+			};
+
+			mutable node_ptr	_node;
+			Alloc_storage		_alloc_buf;
+			bool				_has_alloc;
+
+			Rb_tree_node_handle(node_ptr node, const NodeAlloc &a) : _node(node), _has_alloc(false)
+			{ _build_alloc(a); }
+
+			NodeAlloc	&_alloc()
+			{ return (*reinterpret_cast<NodeAlloc*>(_alloc_buf.bytes)); }
+
+			const NodeAlloc	&_alloc() const
+			{ return (*reinterpret_cast<const NodeAlloc*>(_alloc_buf.bytes)); }
+
+			//Only while the storage is empty
+			void	_build_alloc(const NodeAlloc &a)
+			{
+				::new(static_cast<void*>(_alloc_buf.bytes)) NodeAlloc(a);
+				_has_alloc = true;
+			}
+
+			void	_set_alloc(const NodeAlloc &a)
+			{
+				if (_has_alloc)
+					_alloc() = a;
+				else
+					_build_alloc(a);
+			}
+
+			//Frees the node, also for a handle taken by const reference (a
+			//temporary). A handle with a node always has its allocator
+			void	_dispose() const
+			{
+				if (_node)
+				{
+					NodeAlloc	a(_alloc());
+
+					allocator_type(a).destroy(&(_node->value));
+					a.deallocate(_node, 1);
+					_node = 0;
+				}
+			}
+
+			void	_reset()
+			{ _dispose(); }
+
+		public:
+			Rb_tree_node_handle() : _node(0), _has_alloc(false) {}
+
+			Rb_tree_node_handle(const Rb_tree_node_handle &src) : _node(src._node), _has_alloc(false)
+			{
+				if (src._has_alloc)
+					_build_alloc(src._alloc());
+				src._node = 0;
+			}
+
+			~Rb_tree_node_handle()
+			{
+				_reset();
+				if (_has_alloc)
+					_alloc().~NodeAlloc();
+			}
+
+			Rb_tree_node_handle	&operator=(const Rb_tree_node_handle &src)
+			{
+				if (this != &src)
+				{
+					_reset();
+					_node = src._node;
+					if (src._has_alloc)
+						_set_alloc(src._alloc());
+					src._node = 0;
+				}
+				return (*this);
+			}
+
+			bool	empty() const
+			{ return (_node == 0); }
+
+			value_type	&value() const
+			{ return (_node->value); }
+
+			//The key may be changed while the node is out of any tree
+			key_type	&key() const
+			{ return (const_cast<key_type&>(KeyOfValue()(_node->value))); }
+
+			//The handle must not be empty
+			allocator_type	get_allocator() const
+			{ return (allocator_type(_alloc())); }
+
+			void	swap(Rb_tree_node_handle &nh)
+			{
+				Rb_tree_node_handle	tmp(nh);
+
+				nh = *this;
+				*this = tmp;
+			}
+	};
+
+	//Holds the comparator of a tree: as a base when it is a class, so an
+	//empty one adds no byte, as a member otherwise (function pointers)
+	template<typename Compare, bool = ft::is_class<Compare>::value>
+	struct Rb_tree_key_compare
+	{
+		Compare	_key_compare;
+
+		Rb_tree_key_compare(const Compare &c) : _key_compare(c) {}
+
+		Compare	&key_comp()
+		{ return (_key_compare); }
+
+		const Compare	&key_comp() const
+		{ return (_key_compare); }
+	};
+
+	template<typename Compare>
+	struct Rb_tree_key_compare<Compare, true> : public Compare
+	{
+		Rb_tree_key_compare(const Compare &c) : Compare(c) {}
+
+		Compare	&key_comp()
+		{ return (*this); }
+
+		const Compare	&key_comp() const
+		{ return (*this); }
+	};
+
 	template<typename Key, typename Value, typename KeyOfValue, typename Compare, typename Alloc = std::allocator<Value> >
 	class Rb_tree
 	{
 		public:
 			typedef Rb_tree_node<Value>						node_struct;
-			typedef typename node_struct::node_ptr			node_ptr;
-			typedef typename node_struct::const_node_ptr	const_node_ptr;
+			typedef Rb_tree_node_base::base_ptr				node_ptr;
+			typedef Rb_tree_node_base::const_base_ptr		const_node_ptr;
+			typedef typename node_struct::link_type			link_type;
+			typedef typename node_struct::const_link_type	const_link_type;
 
 			typedef Key				key_type;
 			typedef	Value			value_type;
@@ -261,392 +915,395 @@ namespace ft
 			typedef ft::reverse_iterator<iterator>			reverse_iterator;
 			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
 
+			typedef Rb_tree_node_handle<Key, Value, KeyOfValue, node_allocator, allocator_type>	node_type;
+
 		private:
-			node_allocator	_node_alloc;
-			key_compare		_comp;
-			node_struct		_header;
-			size_type		_node_count;
+			//The node allocator and the comparator are bases: stateless ones
+			//(std::allocator, std::less) take no room in the tree
+			struct Rb_tree_impl : public node_allocator, public Rb_tree_key_compare<Compare>
+			{
+				Rb_tree_node_base	_header;
+				size_type			_node_count;
+
+				Rb_tree_impl(const Compare &c, const node_allocator &a)
+					: node_allocator(a), Rb_tree_key_compare<Compare>(c), _node_count(0) {}
+			};
+
+			Rb_tree_impl	_impl;
+
+			node_allocator	&_node_alloc()
+			{ return (_impl); }
+
+			const node_allocator	&_node_alloc() const
+			{ return (_impl); }
+
+			key_compare	&_comp()
+			{ return (_impl.key_comp()); }
+
+			const key_compare	&_comp() const
+			{ return (_impl.key_comp()); }
 
 			void	_initialize_header()
 			{
-				_header.color = ft::red;
-				_header.parent = 0;
-				_header.left = &_header;
-				_header.right = &_header;
+				_root() = 0;
+				_impl._header.set_color(ft::red);
+				_impl._header.left = &_impl._header;
+				_impl._header.right = &_impl._header;
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+				_impl._header.size = 0;
+# endif
 			}
 
-			node_ptr	_allocate_node()
-			{ return (_node_alloc.allocate(1)); }
+			link_type	_allocate_node()
+			{ return (_node_alloc().allocate(1)); }
 
 			node_ptr	_create_node(const value_type &val)
 			{
-				node_ptr tmp = _allocate_node();
+				link_type tmp = _allocate_node();
 
-				get_allocator().construct(&(tmp->value), val);
+				try
+				{ get_allocator().construct(&(tmp->value), val); }
+				catch (...)
+				{
+					_deallocate_node(tmp);
+					throw;
+				}
 				return (tmp);
 			}
 
 			void	_deallocate_node(node_ptr node)
 			{
-				_node_alloc.deallocate(node, 1);
+				_node_alloc().deallocate(static_cast<link_type>(node), 1);
 			}
 
 			void	_destroy_node(node_ptr node)
 			{
-				get_allocator().destroy(&(node->value));
+				get_allocator().destroy(&_value(node));
 				_deallocate_node(node);
 			}
 
-			node_ptr	_clone_node(const_node_ptr	node)
+			//Takes a node from the reuse list (chained by right pointers) if
+			//any, only its value is rebuilt
+			node_ptr	_reuse_or_create_node(const value_type &val, node_ptr &reuse)
+			{
+				if (reuse == 0)
+					return (_create_node(val));
+				node_ptr tmp = reuse;
+
+				reuse = reuse->right;
+				get_allocator().destroy(&_value(tmp));
+				try
+				{ get_allocator().construct(&_value(tmp), val); }
+				catch (...)
+				{
+					_deallocate_node(tmp);
+					throw;
+				}
+				return (tmp);
+			}
+
+			node_ptr	_clone_node(const_node_ptr	node, node_ptr &reuse)
 			{
-				node_ptr tmp = _create_node(node->value);
+				node_ptr tmp = _reuse_or_create_node(_value(node), reuse);
 
-				tmp->color = node->color;
+				tmp->set_color(node->get_color());
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+				tmp->size = node->size;
+# endif
 				tmp->left = 0;
 				tmp->right = 0;
 				return (tmp);
 			}
 
 			node_ptr	&_root()
-			{ return (_header.parent); }
+			{ return (_impl._header.red_parent()); }
 
 			const_node_ptr	_root() const
-			{ return (_header.parent); }
+			{ return (_impl._header.get_parent()); }
 
 			node_ptr	&_rightmost()
-			{ return (_header.right); }
+			{ return (_impl._header.right); }
 
 			const_node_ptr	_rightmost() const
-			{ return (_header.right); }
+			{ return (_impl._header.right); }
 
 			node_ptr	&_leftmost()
-			{ return (_header.left); }
+			{ return (_impl._header.left); }
 
 			const_node_ptr	_leftmost() const
-			{ return (_header.left); }
+			{ return (_impl._header.left); }
 
 			node_ptr	_end()
-			{ return (&_header); }
+			{ return (&_impl._header); }
 
 			const_node_ptr	_end() const
-			{ return (&_header); }
+			{ return (&_impl._header); }
+
+			//Links are untyped, only the value needs the node type
+			static value_type	&_value(node_ptr x)
+			{ return (static_cast<link_type>(x)->value); }
 
-			static const Key	&_key(node_ptr x)
-			{ return KeyOfValue()(x->value); }
+			static const value_type	&_value(const_node_ptr x)
+			{ return (static_cast<const_link_type>(x)->value); }
 
 			static const Key	&_key(const_node_ptr x)
-			{ return KeyOfValue()(x->value); }
+			{ return KeyOfValue()(_value(x)); }
 
-			node_ptr	_copy(const_node_ptr node_src, node_ptr parent)
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+			static size_type	_size(const_node_ptr x)
+			{ return (rb_tree_size(x)); }
+
+			//Number of nodes before x in order
+			size_type	_index_of(const_node_ptr x) const
 			{
-				node_ptr top = _clone_node(node_src);
+				if (x == _end())
+					return (_impl._node_count);
+				size_type i = _size(x->left);
 
-				top->parent = parent;
-				if (node_src->right)
-					top->right = _copy(node_src->right, top);
-				parent = top;
-				node_src = node_src->left;
-				while (node_src != 0)
+				for (; x != _root(); x = x->get_parent())
 				{
-					node_ptr y = _clone_node(node_src);
-
-					parent->left = y;
-					y->parent = parent;
-					if (node_src->right)
-						y->right = _copy(node_src->right, y);
-					parent = y;
-					node_src = node_src->left;
+					if (x == x->get_parent()->right)
+						i += _size(x->get_parent()->left) + 1;
 				}
-				return top;
+				return (i);
 			}
 
-			iterator	_insert(const_node_ptr x, const_node_ptr p, const value_type &val)
+			const_node_ptr	_select(size_type k) const
 			{
-				bool insert_left = (x != 0 || p == _end() || _comp(KeyOfValue()(val), _key(p)));
-				node_ptr node = _create_node(val);
-
-				_insert_and_rebalance(insert_left, node, const_cast<node_ptr>(p));
-				++_node_count;
-				return iterator(node);
-			}
+				const_node_ptr x = _root();
 
-			void	_rotate_left(node_ptr const x, node_ptr &root)
-			{
-				node_ptr const y = x->right;
+				while (x != 0)
+				{
+					const size_type left = _size(x->left);
 
-				x->right = y->left;
-				if(y->left != 0)
-					y->left->parent = x;
-				y->parent = x->parent;
-				if (x == root)
-					root = y;
-				else if (x == x->parent->left)
-					x->parent->left = y;
-				else
-					x->parent->right = y;
-				y->left = x;
-				x->parent = y;
+					if (k < left)
+						x = x->left;
+					else if (k == left)
+						return (x);
+					else
+					{
+						k -= left + 1;
+						x = x->right;
+					}
+				}
+				return (_end());
 			}
+# endif
 
-			void	_rotate_right(node_ptr const x, node_ptr &root)
+			node_ptr	_copy(const_node_ptr node_src, node_ptr parent, node_ptr &reuse)
 			{
-				node_ptr const y = x->left;
+				node_ptr top = _clone_node(node_src, reuse);
 
-				x->left = y->right;
-				if (y->right != 0)
-					y->right->parent = x;
-				y->parent = x->parent;
-				if (x == root)
-					root = y;
-				else if (x->parent->left == x)
-					x->parent->left = y;
-				else
-					x->parent->right = y;
-				y->right = x;
-				x->parent = y;
-			}
-
-			void	_colorflip(node_ptr &x, node_ptr const x_uncle, node_ptr const x_gp)
-			{
-				x->parent->color = ft::black;
-				x_uncle->color = ft::black;
-				x_gp->color = ft::red;
-				x = x_gp;
-			}
-
-			void	_insert_and_rebalance(const bool insert_left, node_ptr x, node_ptr p)
-			{
-				node_ptr	&root = _root();
-
-				//Init node
-				x->parent = p;
-				x->left = 0;
-				x->right = 0;
-				x->color = ft::red;
-				//Insert
-				if (insert_left)
+				top->set_parent(parent);
+				try
 				{
-					p->left = x;
-					if (p == &_header)
+					if (node_src->right)
+						top->right = _copy(node_src->right, top, reuse);
+					parent = top;
+					node_src = node_src->left;
+					while (node_src != 0)
 					{
-						_header.parent = x;
-						_header.right = x;
+						node_ptr y = _clone_node(node_src, reuse);
+
+						parent->left = y;
+						y->set_parent(parent);
+						if (node_src->right)
+							y->right = _copy(node_src->right, y, reuse);
+						parent = y;
+						node_src = node_src->left;
 					}
-					else if (p == _header.left)
-						_header.left = x;
 				}
-				else
+				catch (...)
 				{
-					p->right = x;
-					if (p == _header.right)
-						_header.right = x;
+					_delete(top);
+					throw;
 				}
-				//Rebalance
-				while (x != root && x->parent->color == ft::red)
+				return top;
+			}
+
+			node_ptr	_copy(const_node_ptr node_src, node_ptr parent)
+			{
+				node_ptr none = 0;
+
+				return (_copy(node_src, parent, none));
+			}
+
+			//Unlinks every node and chains them through their right pointer,
+			//right rotations flatten the tree in O(n) without recursion
+			node_ptr	_harvest_nodes()
+			{
+				node_ptr	x = _root();
+				node_ptr	list = 0;
+
+				while (x != 0)
 				{
-					node_ptr const x_gp =  x->parent->parent;
-					if (x->parent == x_gp->left) //if xparent is leftchild
+					if (x->left != 0)
 					{
-						node_ptr const x_uncle = x_gp->right;
+						node_ptr y = x->left;
 
-						if (x_uncle && x_uncle->color == ft::red)
-							_colorflip(x, x_uncle, x_gp);
-						else
-						{
-							if (x == x->parent->right)
-							{
-								x = x->parent;
-								_rotate_left(x, root);
-							}
-							x->parent->color = ft::black; //uncle is already black
-							x_gp->color = ft::red;
-							_rotate_right(x_gp, root);
-						}
+						x->left = y->right;
+						y->right = x;
+						x = y;
 					}
-					else // xparent is rightchild
+					else
 					{
-						node_ptr const x_uncle = x_gp->left;
+						node_ptr next = x->right;
 
-						if (x_uncle && x_uncle->color == ft::red)
-							_colorflip(x, x_uncle, x_gp);
-						else
-						{
-							if (x == x->parent->left)
-							{
-								x = x->parent;
-								_rotate_right(x, root);
-							}
-							x->parent->color = ft::black; //uncle is already black
-							x_gp->color = ft::red;
-							_rotate_left(x_gp, root);
-						}
+						x->right = list;
+						list = x;
+						x = next;
 					}
 				}
-				root->color = ft::black;
+				_root() = 0;
+				_leftmost() = _end();
+				_rightmost() = _end();
+				_impl._node_count = 0;
+				return (list);
 			}
 
-			bool		_is_black(node_ptr x)
-			{ return (x == 0 || x->color == ft::black); }
+			void	_delete_list(node_ptr x)
+			{
+				while (x != 0)
+				{
+					node_ptr next = x->right;
 
-			node_ptr	_rebalance_for_erase(node_ptr const z)
+					_destroy_node(x);
+					x = next;
+				}
+			}
+
+			iterator	_insert_node(const_node_ptr x, const_node_ptr p, node_ptr node)
 			{
-				node_ptr &root = _root();
-				node_ptr &leftmost = _header.left;
-				node_ptr &rightmost = _header.right;
-				node_ptr y = z; //el to navigate;
-				node_ptr x = 0; //to find child
-				node_ptr x_parent = 0;
+				bool insert_left = (x != 0 || p == _end() || _comp()(_key(node), _key(p)));
 
-				if (y->left == 0)
-					x = y->right;
-				else
+				rb_tree_insert_and_rebalance(insert_left, node, const_cast<node_ptr>(p), _impl._header);
+				++_impl._node_count;
+				return iterator(node);
+			}
+
+			iterator	_insert(const_node_ptr x, const_node_ptr p, const value_type &val)
+			{ return (_insert_node(x, p, _create_node(val))); }
+
+			//Where a node of key k has to be linked: (x, parent) for _insert,
+			//or (equal node, 0) when the key is already there
+			ft::pair<node_ptr, node_ptr>	_get_insert_unique_pos(const key_type &k)
+			{
+				node_ptr x = _root();
+				node_ptr y = _end();
+				bool comp = true;
+
+				while (x != 0)
 				{
-					if (y->right == 0)
-						x = y->left;
+					y = x;
+					comp = _comp()(k, _key(x));
+					x = comp ? x->left : x->right;
+				}
+				iterator j = iterator(y);
+				if (comp)
+				{
+					if (j == begin())
+						return ft::pair<node_ptr, node_ptr>(x, y);
 					else
-					{
-						y = y->right;
-						while (y->left) //find successor;
-							y = y->left;
-						x = y->right; //child successor
-					}
+						--j;
+				}
+				if (_comp()(_key(j.node), k))
+					return ft::pair<node_ptr, node_ptr>(x, y);
+				return ft::pair<node_ptr, node_ptr>(j.node, 0);
+			}
+
+			//Where a node of key k has to be linked after its equals
+			ft::pair<node_ptr, node_ptr>	_get_insert_equal_pos(const key_type &k)
+			{
+				node_ptr x = _root();
+				node_ptr y = _end();
+
+				while (x != 0)
+				{
+					y = x;
+					x = _comp()(k, _key(x)) ? x->left : x->right;
+				}
+				return ft::pair<node_ptr, node_ptr>(x, y);
+			}
+
+			//Links val before its equals, for hints that turned out too far
+			iterator	_insert_equal_lower(const value_type &val)
+			{
+				const key_type	&k = KeyOfValue()(val);
+				node_ptr		x = _root();
+				node_ptr		y = _end();
+
+				while (x != 0)
+				{
+					y = x;
+					x = !_comp()(_key(x), k) ? x->left : x->right;
 				}
-				if (y != z) //relink y(successor) to z;
+				node_ptr node = _create_node(val);
+
+				rb_tree_insert_and_rebalance(y == _end() || !_comp()(_key(y), k), node, y, _impl._header);
+				++_impl._node_count;
+				return iterator(node);
+			}
+
+			//First node not lesser than k / greater than k in the subtree x,
+			//y if there is none
+			const_node_ptr	_lower_bound(const_node_ptr x, const_node_ptr y, const key_type &k) const
+			{
+				while (x != 0)
 				{
-					z->left->parent = y; //link succesor with z left child
-					y->left = z->left;  // same
-					if (y != z->right) //if successor is not z right
+					if (!_comp()(_key(x), k)) //x is not lesser than k
 					{
-						x_parent = y->parent;
-						if (x)
-							x->parent = y->parent;
-						y->parent->left = x;
-						y->right = z->right;
-						z->right->parent = y;
+						y = x;
+						x = x->left;
 					}
 					else
-						x_parent = y;
-					if (root == z)
-						root = y;
-					else if (z->parent->left == z)
-						z->parent->left = y;
-					else
-						z->parent->right = y;
-					y->parent = z->parent;
-					std::swap(y->color, z->color);
-					y = z;
+						x = x->right;
 				}
-				else
+				return (y);
+			}
+
+			const_node_ptr	_upper_bound(const_node_ptr x, const_node_ptr y, const key_type &k) const
+			{
+				while (x != 0)
 				{
-					x_parent = y->parent;
-					if (x)
-						x->parent = y->parent;
-					if (root == z)
-						root = x;
-					else
-					{	//make z parent point to x;
-						if (z->parent->left == z)
-							z->parent->left = x;
-						else
-							z->parent->right = x;
-					}
-					if (leftmost == z)
+					if (_comp()(k, _key(x))) //k is smaller than x
 					{
-						if (z->right == 0)
-							leftmost = z->parent;
-						else
-							leftmost = node_struct::minimum(x);
-					}
-					if (rightmost == z)
-					{
-						if (z->left == 0)
-							rightmost = z->parent;
-						else
-							rightmost = node_struct::maximum(x);
+						y = x;
+						x = x->left;
 					}
+					else
+						x = x->right;
 				}
-				if (y->color != ft::red)
+				return (y);
+			}
+
+			//One descent down to the first node equal to k, then both bounds
+			//are searched in its subtrees only
+			ft::pair<const_node_ptr, const_node_ptr>	_equal_range(const key_type &k) const
+			{
+				const_node_ptr x = _root();
+				const_node_ptr y = _end();
+
+				while (x != 0)
 				{
-					while (x != root && _is_black(x))
+					if (_comp()(_key(x), k))
+						x = x->right;
+					else if (_comp()(k, _key(x)))
 					{
-						if (x == x_parent->left)
-						{
-							node_ptr w = x_parent->right;
-							if (w->color == ft::red)
-							{
-								w->color = ft::black;
-								x_parent->color = ft::red;
-								_rotate_left(x_parent, root);
-								w = x_parent->right;
-							}
-							if (_is_black(w->left) && _is_black(w->right))
-							{
-								w->color = ft::red;
-								x = x_parent;
-								x_parent = x_parent->parent;
-							}
-							else
-							{
-								if (_is_black(w->right))
-								{
-									w->left->color = ft::black;
-									w->color = ft::red;
-									_rotate_right(w, root);
-									w = x_parent->right;
-								}
-								w->color = x_parent->color;
-								x_parent->color = ft::black;
-								if (w->right)
-									w->right->color = ft::black;
-								_rotate_left(x_parent, root);
-								break;
-							}
-						}
-						else
-						{
-							node_ptr w = x_parent->left;
-							if (w->color == ft::red)
-							{
-								w->color = ft::black;
-								x_parent->color = ft::red;
-								_rotate_right(x_parent, root);
-								w = x_parent->left;
-							}
-							if (_is_black(w->right) && _is_black(w->left))
-							{
-								w->color = ft::red;
-								x = x_parent;
-								x_parent = x_parent->parent;
-							}
-							else
-							{
-								if (_is_black(w->left))
-								{
-									w->right->color = ft::black;
-									w->color = ft::red;
-									_rotate_left(w, root);
-									w = x_parent->left;
-								}
-								w->color = x_parent->color;
-								x_parent->color = ft::black;
-								if (w->left)
-									w->left->color = ft::black;
-								_rotate_right(x_parent, root);
-								break;
-							}
-						}
+						y = x;
+						x = x->left;
 					}
-					if (x)
-						x->color = ft::black;
+					else
+						return ft::pair<const_node_ptr, const_node_ptr>(_lower_bound(x->left, x, k),
+							_upper_bound(x->right, y, k));
 				}
-				return (y);
+				return ft::pair<const_node_ptr, const_node_ptr>(y, y);
 			}
 
 			void	_erase(const_iterator position)
 			{
-				node_ptr el = _rebalance_for_erase(const_cast<node_ptr>(position.node));
+				node_ptr el = rb_tree_rebalance_for_erase(const_cast<node_ptr>(position.node), _impl._header);
 				_destroy_node(el);
-				--_node_count;
+				--_impl._node_count;
 			}
 
 			void	_erase(const_iterator first, const_iterator last)
@@ -660,6 +1317,51 @@ namespace ft
 				}
 			}
 
+			//Splits the subtree x of black height h into the nodes lesser than
+			//k (lo) and the others (hi), one _join per level: O(log n) overall
+			void	_split(node_ptr x, size_type h, const key_type &k,
+				node_ptr &lo, size_type &hlo, node_ptr &hi, size_type &hhi)
+			{
+				if (x == 0)
+				{
+					lo = 0;
+					hi = 0;
+					hlo = 0;
+					hhi = 0;
+					return ;
+				}
+				node_ptr		left = x->left;
+				node_ptr		right = x->right;
+				const size_type	hc = h - (x->get_color() == ft::black ? 1 : 0);
+				node_ptr		sub;
+				size_type		hsub;
+
+				if (_comp()(_key(x), k))
+				{
+					_split(right, hc, k, sub, hsub, hi, hhi);
+					lo = rb_tree_join(left, x, sub, hc, hsub, hlo);
+				}
+				else
+				{
+					_split(left, hc, k, lo, hlo, sub, hsub);
+					hi = rb_tree_join(sub, x, right, hsub, hc, hhi);
+				}
+			}
+
+			void	_set_root(node_ptr x)
+			{
+				_root() = x;
+				if (x == 0)
+				{
+					_leftmost() = _end();
+					_rightmost() = _end();
+					return ;
+				}
+				x->set_parent(_end());
+				_leftmost() = Rb_tree_node_base::minimum(x);
+				_rightmost() = Rb_tree_node_base::maximum(x);
+			}
+
 			void	_delete(node_ptr x)
 			{
 				while (x != 0)
@@ -671,21 +1373,136 @@ namespace ft
 				}
 			}
 
+			//Checks that keys are increasing (strictly if unique) and counts them
+			template<typename Iterator>
+			bool	_sorted(Iterator first, Iterator last, size_type &n, bool unique) const
+			{
+				Iterator	next = first;
+
+				n = 0;
+				if (first == last)
+					return (true);
+				for (++next, n = 1; next != last; ++first, ++next, ++n)
+				{
+					if (unique ? !_comp()(KeyOfValue()(*first), KeyOfValue()(*next))
+						: _comp()(KeyOfValue()(*next), KeyOfValue()(*first)))
+						return (false);
+				}
+				return (true);
+			}
+
+			//Links the n sorted values of first as the whole (empty) tree
+			template<typename Iterator>
+			void	_build_from_sorted(Iterator first, size_type n)
+			{
+				size_type	red_depth = 0;
+
+				for (size_type m = n + 1; m > 1; m >>= 1)
+					++red_depth;
+				_root() = _build_sorted(first, n, 0, red_depth);
+				_root()->set_parent(_end());
+				_leftmost() = Rb_tree_node_base::minimum(_root());
+				_rightmost() = Rb_tree_node_base::maximum(_root());
+				_impl._node_count = n;
+			}
+
+			//Builds a perfectly balanced subtree out of the next n sorted values.
+			//Nil links all sit at depth red_depth or red_depth + 1, so coloring
+			//the nodes of depth red_depth red keeps every black height equal
+			template<typename Iterator>
+			node_ptr	_build_sorted(Iterator &first, size_type n, size_type depth, size_type red_depth)
+			{
+				if (n == 0)
+					return (0);
+				node_ptr	left = _build_sorted(first, (n - 1) / 2, depth + 1, red_depth);
+				node_ptr	top = 0;
+
+				try
+				{
+					top = _create_node(*first);
+					++first;
+					top->right = _build_sorted(first, n / 2, depth + 1, red_depth);
+				}
+				catch (...)
+				{
+					_delete(left);
+					if (top)
+						_destroy_node(top);
+					throw;
+				}
+				top->set_color(depth == red_depth ? ft::red : ft::black);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+				top->size = n;
+# endif
+				top->left = left;
+				if (left)
+					left->set_parent(top);
+				if (top->right)
+					top->right->set_parent(top);
+				return (top);
+			}
+
+			template<typename Iterator>
+			void	_insert_unique_range(Iterator first, Iterator last, std::input_iterator_tag)
+			{
+				for (; first != last; ++first)
+					insert_unique(end(), *first);
+			}
+
+			//Sorted input into an empty tree is linked directly in O(n)
+			template<typename Iterator>
+			void	_insert_unique_range(Iterator first, Iterator last, std::forward_iterator_tag)
+			{
+				size_type	n;
+
+				if (_impl._node_count == 0 && _sorted(first, last, n, true) && n != 0)
+					_build_from_sorted(first, n);
+				else
+				{
+					for (; first != last; ++first)
+						insert_unique(end(), *first);
+				}
+			}
+
+			template<typename Iterator>
+			void	_insert_equal_range(Iterator first, Iterator last, std::input_iterator_tag)
+			{
+				for (; first != last; ++first)
+					insert_equal(end(), *first);
+			}
+
+			//Sorted input (duplicates allowed) into an empty tree is linked
+			//directly in O(n), otherwise end() hints make sorted runs O(1) each
+			template<typename Iterator>
+			void	_insert_equal_range(Iterator first, Iterator last, std::forward_iterator_tag)
+			{
+				size_type	n;
+
+				if (_impl._node_count == 0 && _sorted(first, last, n, false) && n != 0)
+					_build_from_sorted(first, n);
+				else
+				{
+					for (; first != last; ++first)
+						insert_equal(end(), *first);
+				}
+			}
+
 		public:
 			//CONSTRUCTOR && DESTRUCTOR && operator=
 			Rb_tree(const key_compare& c = key_compare(), const allocator_type &a = allocator_type())
-			: _node_alloc(a), _comp(c),_node_count(0)
+			: _impl(c, a)
 			{ _initialize_header(); }
 
 			Rb_tree(const Rb_tree &x)
-			: _node_alloc(x._node_alloc), _comp(x._comp), _node_count(x._node_count)
+			: _impl(x._comp(), x._node_alloc())
 			{
 				_initialize_header();
 				if (x._root() != 0)
 				{
 					_root() = _copy(x._root(), _end());
-					_leftmost() = node_struct::minimum(_root());
-					_rightmost() = node_struct::maximum(_root());
+					_leftmost() = Rb_tree_node_base::minimum(_root());
+					_rightmost() = Rb_tree_node_base::maximum(_root());
+					_impl._node_count = x._impl._node_count;
 				}
 			}
 
@@ -697,40 +1514,54 @@ namespace ft
 			{
 				if (this != &src)
 				{
-					clear();
-					_comp = src._comp;
-					if (src._root())
+					//Nodes of the old content are recycled for the copy, only
+					//the size difference is allocated or freed
+					node_ptr reuse = _harvest_nodes();
+
+					_comp() = src._comp();
+					try
+					{
+						if (src._root())
+						{
+							_root() = _copy(src._root(), _end(), reuse);
+							_leftmost() = Rb_tree_node_base::minimum(_root());
+							_rightmost() = Rb_tree_node_base::maximum(_root());
+							_impl._node_count = src._impl._node_count;
+						}
+					}
+					catch (...)
 					{
-						_root() = _copy(src._root(), _end());
-						_leftmost() = node_struct::minimum(_root());
-						_rightmost() = node_struct::maximum(_root());
-						_node_count = src._node_count;
+						_delete_list(reuse);
+						throw;
 					}
+					_delete_list(reuse);
 				}
 				return (*this);
 			}
 
 			//Allocator, Iterator && Utils
-			allocator_type get_allocator()
-			{ return allocator_type();}
+			//A rebound copy of the stored node allocator, so stateful
+			//allocators (arenas) see every value built or destroyed
+			allocator_type get_allocator() const
+			{ return (allocator_type(_node_alloc())); }
 
 			node_allocator	&get_node_allocator()
-			{ return node_allocator();}
+			{ return (_node_alloc()); }
 
 			const node_allocator	&get_node_allocator() const
-			{ return node_allocator();}
+			{ return (_node_alloc()); }
 			//Iterators
 			iterator begin()
-			{ return iterator(_header.left); }
+			{ return iterator(_impl._header.left); }
 
 			const_iterator begin() const
-			{ return const_iterator(_header.left); }
+			{ return const_iterator(_impl._header.left); }
 
 			iterator end()
-			{ return iterator(&_header); }
+			{ return iterator(&_impl._header); }
 
 			const_iterator end() const
-			{ return const_iterator(&_header); }
+			{ return const_iterator(&_impl._header); }
 
 			reverse_iterator	rbegin()
 			{ return reverse_iterator(end()); }
@@ -746,102 +1577,51 @@ namespace ft
 
 			//Utils
 			Compare	key_comp() const
-			{ return (_comp); }
+			{ return (_comp()); }
 
 			size_type	size() const
-			{ return (_node_count); }
+			{ return (_impl._node_count); }
 
 			bool	empty() const
-			{ return (_node_count == 0); }
+			{ return (_impl._node_count == 0); }
 
 			size_type	max_size() const
-			{ return (_node_alloc.max_size()); }
+			{ return (_node_alloc().max_size()); }
 
 			//Operations
 			iterator	lower_bound(const key_type &k)
-			{
-				node_ptr x = _root();
-				node_ptr y = _end();
-
-				while (x != 0)
-				{
-					if (!_comp(_key(x), k)) //x is not lesser than k
-					{
-						y = x;
-						x = x->left;
-					}
-					else
-						x = x->right;
-				}
-				return iterator(y);
-			}
+			{ return iterator(const_cast<node_ptr>(_lower_bound(_root(), _end(), k))); }
 
 			const_iterator	lower_bound(const key_type &k) const
-			{
-				const_node_ptr x = _root();
-				const_node_ptr y = _end();
-
-				while (x != 0)
-				{
-					if (!_comp(_key(x), k)) //x is not lesser than k
-					{
-						y = x;
-						x = x->left;
-					}
-					else
-						x = x->right;
-				}
-				return const_iterator(y);
-			}
+			{ return const_iterator(_lower_bound(_root(), _end(), k)); }
 
 			iterator	upper_bound(const key_type &k)
-			{
-				node_ptr x = _root();
-				node_ptr y = _end();
-
-				while (x != 0)
-				{
-					if (_comp(k, _key(x))) //k is smaller than x
-					{
-						y = x;
-						x = x->left;
-					}
-					else
-						x = x->right;
-				}
-				return iterator(y);
-			}
-
+			{ return iterator(const_cast<node_ptr>(_upper_bound(_root(), _end(), k))); }
 
 			const_iterator	upper_bound(const key_type &k) const
+			{ return const_iterator(_upper_bound(_root(), _end(), k)); }
+
+			ft::pair<iterator, iterator>	equal_range(const key_type &k)
 			{
-				const_node_ptr x = _root();
-				const_node_ptr y = _end();
+				ft::pair<const_node_ptr, const_node_ptr> range = _equal_range(k);
 
-				while (x != 0)
-				{
-					if (_comp(k, _key(x)))
-					{
-						y = x;
-						x = x->left;
-					}
-					else
-						x = x->right;
-				}
-				return const_iterator(y);
+				return (ft::pair<iterator, iterator>(iterator(const_cast<node_ptr>(range.first)),
+					iterator(const_cast<node_ptr>(range.second))));
 			}
 
-			ft::pair<iterator, iterator>	equal_range(const key_type &k)
-			{ return (ft::pair<iterator, iterator>(lower_bound(k), upper_bound(k))); }
-
 			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
-			{ return (ft::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k))); }
+			{
+				ft::pair<const_node_ptr, const_node_ptr> range = _equal_range(k);
+
+				return (ft::pair<const_iterator, const_iterator>(const_iterator(range.first),
+					const_iterator(range.second)));
+			}
 
 			iterator	find(const key_type &k)
 			{
 				iterator find = lower_bound(k);
 
-				if (find == end() || _comp(k, _key(find.node)))
+				if (find == end() || _comp()(k, _key(find.node)))
 					return end();
 				else
 					return find;
@@ -851,42 +1631,100 @@ namespace ft
 			{
 				const_iterator find = lower_bound(k);
 
-				if (find == end() || _comp(k, _key(find.node)))
+				if (find == end() || _comp()(k, _key(find.node)))
 					return end();
 				else
 					return find;
 			}
 
-	 		size_type	count(const Key &k) const
+			//O(log n + count), O(log n) with order statistics
+			size_type	count(const Key &k) const
 			{
 				pair<const_iterator, const_iterator> pair = equal_range(k);
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+				return (_index_of(pair.second.node) - _index_of(pair.first.node));
+# else
 				return (size_type(std::distance(pair.first, pair.second)));
+# endif
 			}
 
-			//insert
-			ft::pair<iterator, bool>	insert_unique(const value_type &val)
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+			//Order statistics
+			//Number of elements whose key is lesser than k
+			size_type	rank(const key_type &k) const
 			{
-				node_ptr x = _root();
-				node_ptr y = _end();
-				bool comp = true;
+				const_node_ptr	x = _root();
+				size_type		r = 0;
 
 				while (x != 0)
 				{
-					y = x;
-					comp = _comp(KeyOfValue()(val), _key(x));
-					x = comp ? x->left : x->right;
+					if (_comp()(_key(x), k))
+					{
+						r += _size(x->left) + 1;
+						x = x->right;
+					}
+					else
+						x = x->left;
 				}
-				iterator j = iterator(y);
-				if (comp)
+				return (r);
+			}
+
+			//k-th element in order (from 0), end() if k >= size()
+			iterator	select(size_type k)
+			{ return iterator(const_cast<node_ptr>(_select(k))); }
+
+			const_iterator	select(size_type k) const
+			{ return const_iterator(_select(k)); }
+
+			//Number of elements in [lo, hi)
+			size_type	count_range(const key_type &lo, const key_type &hi) const
+			{
+				if (!_comp()(lo, hi))
+					return (0);
+				return (rank(hi) - rank(lo));
+			}
+
+			size_type	index_of(const_iterator position) const
+			{ return (_index_of(position.node)); }
+
+			size_type	size(const_iterator first, const_iterator last) const
+			{ return (_index_of(last.node) - _index_of(first.node)); }
+# endif
+
+			//insert
+			ft::pair<iterator, bool>	insert_unique(const value_type &val)
+			{
+				ft::pair<node_ptr, node_ptr> pos = _get_insert_unique_pos(KeyOfValue()(val));
+
+				if (pos.second)
+					return ft::pair<iterator, bool>(_insert(pos.first, pos.second, val), true);
+				return ft::pair<iterator, bool>(iterator(pos.first), false);
+			}
+
+			//Node handle, relinks the extracted node itself. If the key is
+			//already there the handle keeps its node. Taken by const reference
+			//so the result of extract() can be passed directly, the handle
+			//gives its node away like std::auto_ptr
+			ft::pair<iterator, bool>	insert_unique(const node_type &nh)
+			{
+				if (nh.empty())
+					return ft::pair<iterator, bool>(end(), false);
+				if (nh._alloc() != _node_alloc()) //node can't change allocator: copy
 				{
-					if (j == begin())
-						return ft::pair<iterator, bool>(_insert(x, y, val), true);
-					else
-						--j;
+					ft::pair<iterator, bool> res = insert_unique(nh._node->value);
+
+					if (res.second)
+						nh._dispose();
+					return res;
 				}
-				if (_comp(_key(j.node), KeyOfValue()(val)))
-					return ft::pair<iterator, bool>(_insert(x, y, val), true);
-				return ft::pair<iterator, bool>(j, false);
+				ft::pair<node_ptr, node_ptr> pos = _get_insert_unique_pos(_key(nh._node));
+
+				if (pos.second == 0)
+					return ft::pair<iterator, bool>(iterator(pos.first), false);
+				iterator it = _insert_node(pos.first, pos.second, nh._node);
+
+				nh._node = 0;
+				return ft::pair<iterator, bool>(it, true);
 			}
 
 
@@ -895,19 +1733,19 @@ namespace ft
 			{
 				if (position.node == _end())
 				{
-					if (_node_count > 0 && _comp(_key(_rightmost()), KeyOfValue()(val))) //Greater than maxvalue
+					if (_impl._node_count > 0 && _comp()(_key(_rightmost()), KeyOfValue()(val))) //Greater than maxvalue
 						return (_insert(0, _rightmost(), val));
 					else
 						return (insert_unique(val).first);
 
 				}
-				else if (_comp(KeyOfValue()(val), _key(position.node))) //val before position (so al smaller)
+				else if (_comp()(KeyOfValue()(val), _key(position.node))) //val before position (so al smaller)
 				{
 					const_iterator before = position;
 
 					if (position.node == _leftmost())
 						return (_insert(_leftmost(), _leftmost(), val));
-					else if (_comp(_key((--before).node), KeyOfValue()(val))) // val greater than before
+					else if (_comp()(_key((--before).node), KeyOfValue()(val))) // val greater than before
 					{
 						if (before.node->right == 0)
 							return (_insert(0, before.node, val)); //right insert
@@ -917,13 +1755,13 @@ namespace ft
 					else
 						return (insert_unique(val).first);
 				}
-				else if (_comp(KeyOfValue()(position.node->value), KeyOfValue()(val))) // val after position (so val greater)
+				else if (_comp()(_key(position.node), KeyOfValue()(val))) // val after position (so val greater)
 				{
 					const_iterator after = position;
 
 					if (position.node == _rightmost())
 						return (_insert(0, _rightmost(), val)); //right;
-					else if(_comp(KeyOfValue()(val), _key((++after).node))) //val smaller than after
+					else if(_comp()(KeyOfValue()(val), _key((++after).node))) //val smaller than after
 					{
 						if (!position.node->right)
 							return (_insert(0, position.node, val));
@@ -941,8 +1779,104 @@ namespace ft
 			template<typename Iterator>
 			void	insert_unique(Iterator first, Iterator last)
 			{
-				for (; first != last; ++first)
-					insert_unique(end(), *first);
+				typedef typename ft::iterator_traits<Iterator>::iterator_category	category;
+
+				_insert_unique_range(first, last, category());
+			}
+
+			//Equal keys allowed, val goes after its equals
+			iterator	insert_equal(const value_type &val)
+			{
+				ft::pair<node_ptr, node_ptr> pos = _get_insert_equal_pos(KeyOfValue()(val));
+
+				return (_insert(pos.first, pos.second, val));
+			}
+
+			iterator	insert_equal(const node_type &nh)
+			{
+				if (nh.empty())
+					return (end());
+				if (nh._alloc() != _node_alloc()) //node can't change allocator: copy
+				{
+					iterator it = insert_equal(nh._node->value);
+
+					nh._dispose();
+					return (it);
+				}
+				ft::pair<node_ptr, node_ptr> pos = _get_insert_equal_pos(_key(nh._node));
+				iterator it = _insert_node(pos.first, pos.second, nh._node);
+
+				nh._node = 0;
+				return (it);
+			}
+
+			//With hint: val is linked right before position in O(1) amortized
+			//when it fits there, so appending a run of equal (or increasing)
+			//keys with end() never searches
+			iterator	insert_equal(const_iterator position, const value_type &val)
+			{
+				const key_type	&k = KeyOfValue()(val);
+
+				if (position.node == _end())
+				{
+					if (_impl._node_count > 0 && !_comp()(k, _key(_rightmost()))) //Not lesser than maxvalue
+						return (_insert(0, _rightmost(), val));
+					return (insert_equal(val));
+				}
+				else if (!_comp()(_key(position.node), k)) //val not after position
+				{
+					const_iterator before = position;
+
+					if (position.node == _leftmost())
+						return (_insert(_leftmost(), _leftmost(), val));
+					else if (!_comp()(k, _key((--before).node))) //val not before before
+					{
+						if (before.node->right == 0)
+							return (_insert(0, before.node, val)); //right insert
+						return (_insert(position.node, position.node, val)); //left insert
+					}
+					return (insert_equal(val));
+				}
+				else //val after position
+				{
+					const_iterator after = position;
+
+					if (position.node == _rightmost())
+						return (_insert(0, _rightmost(), val));
+					else if (!_comp()(_key((++after).node), k)) //val not after after
+					{
+						if (position.node->right == 0)
+							return (_insert(0, position.node, val));
+						return (_insert(after.node, after.node, val));
+					}
+					return (_insert_equal_lower(val));
+				}
+			}
+
+			template<typename Iterator>
+			void	insert_equal(Iterator first, Iterator last)
+			{
+				typedef typename ft::iterator_traits<Iterator>::iterator_category	category;
+
+				_insert_equal_range(first, last, category());
+			}
+
+			//Unlinks the element without destroying it
+			node_type	extract(const_iterator position)
+			{
+				node_ptr node = rb_tree_rebalance_for_erase(const_cast<node_ptr>(position.node), _impl._header);
+
+				--_impl._node_count;
+				return node_type(static_cast<link_type>(node), _node_alloc());
+			}
+
+			node_type	extract(const key_type &k)
+			{
+				const_iterator it = find(k);
+
+				if (it == end())
+					return (node_type(0, _node_alloc()));
+				return extract(it);
 			}
 
 			void	erase(iterator position)
@@ -968,10 +1902,10 @@ namespace ft
 			void	clear()
 			{
 				_delete(_root());
-				_leftmost() = &_header;
-				_rightmost() = &_header;
-				_header.parent = 0;
-				_node_count = 0;
+				_leftmost() = &_impl._header;
+				_rightmost() = &_impl._header;
+				_root() = 0;
+				_impl._node_count = 0;
 			}
 
 			void	swap(Rb_tree<Key, Value, KeyOfValue, Compare, Alloc> &tree)
@@ -983,7 +1917,7 @@ namespace ft
 						_root() = tree._root();
 						_leftmost() = tree._leftmost();
 						_rightmost() = tree._rightmost();
-						_root()->parent = _end();
+						_root()->set_parent(_end());
 						tree._root() = 0;
 						tree._leftmost() = tree._end();
 						tree._rightmost() =  tree._end();
@@ -994,7 +1928,7 @@ namespace ft
 					tree._root() = _root();
 					tree._leftmost() = _leftmost();
 					tree._rightmost() = _rightmost();
-					tree._root()->parent = tree._end();
+					tree._root()->set_parent(tree._end());
 					_root() = 0;
 					_leftmost() = _end();
 					_rightmost() = _end();
@@ -1004,13 +1938,77 @@ namespace ft
 					std::swap(_root(), tree._root());
 					std::swap(_leftmost(), tree._leftmost());
 					std::swap(_rightmost(), tree._rightmost());
-					_root()->parent = _end();
-					tree._root()->parent = tree._end();
+					_root()->set_parent(_end());
+					tree._root()->set_parent(tree._end());
+				}
+				std::swap(_impl._node_count, tree._impl._node_count);
+				std::swap(_comp(), tree._comp());
+				if (_node_alloc() != tree._node_alloc())
+					std::swap(_node_alloc(), tree._node_alloc());
+			}
+
+			//Split && join, nodes are relinked, never copied
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+			//Moves the elements whose key is not lesser than k into tree, whose
+			//previous content is cleared, in O(log n). Only with order
+			//statistics: the subtree sizes tell how many elements moved,
+			//counting them would make it linear
+			void	split(const key_type &k, Rb_tree &tree)
+			{
+				if (&tree == this)
+					return ;
+				tree.clear();
+				tree._node_alloc() = _node_alloc();
+				tree._comp() = _comp();
+
+				node_ptr		lo;
+				node_ptr		hi;
+				size_type		hlo;
+				size_type		hhi;
+
+				if (lower_bound(k) == end())
+					return ;
+				_split(_root(), rb_tree_black_height(_root()), k, lo, hlo, hi, hhi);
+				_set_root(lo);
+				tree._set_root(hi);
+				_impl._node_count = _size(lo);
+				tree._impl._node_count = _size(hi);
+			}
+# endif
+
+			//Appends the elements of tree, whose keys must all be greater than
+			//ours, and leaves it empty. O(log n), or one insertion per element
+			//when the node allocators differ. Returns false and leaves both
+			//trees untouched when the keys overlap
+			bool	join(Rb_tree &tree)
+			{
+				if (&tree == this)
+					return (tree._root() == 0);
+				if (tree._root() == 0)
+					return (true);
+				if (_root() == 0)
+				{
+					swap(tree);
+					return (true);
+				}
+				if (!_comp()(_key(_rightmost()), _key(tree._leftmost())))
+					return (false);
+				if (_node_alloc() != tree._node_alloc())
+				{
+					insert_unique(tree.begin(), tree.end());
+					tree.clear();
+					return (true);
 				}
-				std::swap(_node_count, tree._node_count);
-				std::swap(_comp, tree._comp);
-				if (_node_alloc != tree._node_alloc)
-					std::swap(_node_alloc, tree._node_alloc);
+				node_ptr	mid = rb_tree_rebalance_for_erase(tree._leftmost(), tree._impl._header);
+				node_ptr	left = _root();
+				node_ptr	right = tree._root();
+				size_type	h;
+
+				_set_root(rb_tree_join(left, mid, right, rb_tree_black_height(left), rb_tree_black_height(right), h));
+				_impl._node_count += tree._impl._node_count;
+				tree._set_root(0);
+				tree._impl._node_count = 0;
+				return (true);
 			}
 	};
 	//Operators
@@ -0,0 +1,205 @@
+#ifndef FT_REALLOC_ALLOCATOR_HPP
+# define FT_REALLOC_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <cstdlib>
+# include <cstring>
+# include <new>
+# include <sys/mman.h>
+# include <unistd.h>
+# include "ft_utilities.hpp"
+
+namespace ft
+{
+	//MALLOC BACKED ALLOCATOR
+	//reallocate() goes through realloc, which extends the block in place when
+	//the heap allows it (and remaps the pages of big blocks on glibc)
+	template<typename T>
+	class malloc_allocator
+	{
+		public:
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef const T*	const_pointer;
+			typedef T&			reference;
+			typedef const T&	const_reference;
+			typedef size_t		size_type;
+			typedef ptrdiff_t	difference_type;
+
+			template<typename U>
+			struct rebind
+			{ typedef malloc_allocator<U> other; };
+
+			malloc_allocator() throw() {}
+
+			malloc_allocator(const malloc_allocator &) throw() {}
+
+			template<typename U>
+			malloc_allocator(const malloc_allocator<U> &) throw() {}
+
+			pointer	address(reference x) const
+			{ return (&x); }
+
+			const_pointer	address(const_reference x) const
+			{ return (&x); }
+
+			pointer	allocate(size_type n, const void * = 0)
+			{
+				void	*p;
+
+				if (n > max_size())
+					throw std::bad_alloc();
+				p = std::malloc(n * sizeof(T));
+				if (p == 0 && n != 0)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(p));
+			}
+
+			void	deallocate(pointer p, size_type)
+			{ std::free(p); }
+
+			//Resizes the block of p to new_n elements. On failure p is left
+			//untouched and bad_alloc is thrown
+			pointer	reallocate(pointer p, size_type, size_type new_n)
+			{
+				void	*q;
+
+				if (new_n > max_size())
+					throw std::bad_alloc();
+				q = std::realloc(static_cast<void*>(p), new_n * sizeof(T));
+				if (q == 0 && new_n != 0)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(q));
+			}
+
+			size_type	max_size() const throw()
+			{ return (size_t(-1) / sizeof(T)); }
+
+			void	construct(pointer p, const T &val)
+			{ ::new(static_cast<void*>(p)) T(val); }
+
+			void	destroy(pointer p)
+			{ p->~T(); }
+
+			template<typename U>
+			bool	operator==(const malloc_allocator<U> &) const
+			{ return (true); }
+
+			template<typename U>
+			bool	operator!=(const malloc_allocator<U> &) const
+			{ return (false); }
+	};
+
+	//MMAP BACKED ALLOCATOR
+	//Every allocation gets its own anonymous mapping rounded up to whole pages,
+	//so it only makes sense for a few huge blocks. reallocate() moves the
+	//pages with mremap on linux instead of copying them
+	template<typename T>
+	class mmap_allocator
+	{
+		public:
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef const T*	const_pointer;
+			typedef T&			reference;
+			typedef const T&	const_reference;
+			typedef size_t		size_type;
+			typedef ptrdiff_t	difference_type;
+
+			template<typename U>
+			struct rebind
+			{ typedef mmap_allocator<U> other; };
+
+		private:
+			static size_t	_bytes(size_type n)
+			{
+				const size_t	page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+				return ((n * sizeof(T) + page - 1) & ~(page - 1));
+			}
+
+		public:
+			mmap_allocator() throw() {}
+
+			mmap_allocator(const mmap_allocator &) throw() {}
+
+			template<typename U>
+			mmap_allocator(const mmap_allocator<U> &) throw() {}
+
+			pointer	address(reference x) const
+			{ return (&x); }
+
+			const_pointer	address(const_reference x) const
+			{ return (&x); }
+
+			pointer	allocate(size_type n, const void * = 0)
+			{
+				void	*p;
+
+				if (n == 0)
+					return (0);
+				if (n > max_size())
+					throw std::bad_alloc();
+				p = mmap(0, _bytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (p == MAP_FAILED)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(p));
+			}
+
+			void	deallocate(pointer p, size_type n)
+			{
+				if (p != 0)
+					munmap(p, _bytes(n));
+			}
+
+			//Resizes the mapping of p from old_n to new_n elements. On failure
+			//p is left untouched and bad_alloc is thrown
+			pointer	reallocate(pointer p, size_type old_n, size_type new_n)
+			{
+				if (p == 0)
+					return (allocate(new_n));
+				if (new_n > max_size())
+					throw std::bad_alloc();
+				if (_bytes(old_n) == _bytes(new_n))
+					return (p);
+# if defined(__linux__) && defined(MREMAP_MAYMOVE)
+				void	*q = mremap(p, _bytes(old_n), _bytes(new_n), MREMAP_MAYMOVE);
+
+				if (q == MAP_FAILED)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(q));
+# else
+				pointer	q = allocate(new_n);
+
+				std::memcpy(static_cast<void*>(q), p, (old_n < new_n ? old_n : new_n) * sizeof(T));
+				deallocate(p, old_n);
+				return (q);
+# endif
+			}
+
+			size_type	max_size() const throw()
+			{ return (size_t(-1) / 2 / sizeof(T)); }
+
+			void	construct(pointer p, const T &val)
+			{ ::new(static_cast<void*>(p)) T(val); }
+
+			void	destroy(pointer p)
+			{ p->~T(); }
+
+			template<typename U>
+			bool	operator==(const mmap_allocator<U> &) const
+			{ return (true); }
+
+			template<typename U>
+			bool	operator!=(const mmap_allocator<U> &) const
+			{ return (false); }
+	};
+
+	template<typename T>
+	struct allocator_can_reallocate<malloc_allocator<T> > : public integral_constant<true> {};
+
+	template<typename T>
+	struct allocator_can_reallocate<mmap_allocator<T> > : public integral_constant<true> {};
+}
+
+#endif
@@ -3,6 +3,20 @@
 
 # include <cstddef>
 
+//Keeps rarely taken paths (reallocation...) out of the inlined fast path
+# if defined(__GNUC__)
+#  define FT_COLD __attribute__((noinline, cold))
+# else
+#  define FT_COLD
+# endif
+
+//Compiler support for ft::is_trivially_copyable, false when unknown
+# if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+#  define FT_IS_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+# else
+#  define FT_IS_TRIVIALLY_COPYABLE(T) false
+# endif
+
 namespace ft
 {
   //////////////////IS_INTEGRAL//////////////////
@@ -53,6 +67,54 @@ namespace ft
   template<>
   struct is_integral<unsigned long long int> : public integral_constant<true> {};
 
+  //////////////////IS_TRIVIALLY_COPYABLE//////////////////
+  //Types copied with memcpy/memmove and never destroyed by ft::vector.
+  //The compiler answers when it can, other types can be specialized:
+  //  template<> struct is_trivially_copyable<Buffer> : public true_type {};
+  template<typename T>
+  struct is_trivially_copyable
+  : public integral_constant<FT_IS_TRIVIALLY_COPYABLE(T) || is_integral<T>::value> {};
+
+  template<typename T>
+  struct is_trivially_copyable<T*> : public integral_constant<true> {};
+  template<>
+  struct is_trivially_copyable<float> : public integral_constant<true> {};
+  template<>
+  struct is_trivially_copyable<double> : public integral_constant<true> {};
+  template<>
+  struct is_trivially_copyable<long double> : public integral_constant<true> {};
+
+  //////////////////IS_TRIVIALLY_RELOCATABLE//////////////////
+  //Types whose objects can be moved to another address with their bytes
+  //(no copy constructor, no destructor on the old address). Lets vector
+  //grow in place through reallocating allocators, specialize it for types
+  //that keep no pointer to themselves
+  template<typename T>
+  struct is_trivially_relocatable
+  : public integral_constant<is_trivially_copyable<T>::value> {};
+
+  //////////////////ALLOCATOR_CAN_REALLOCATE//////////////////
+  //Allocators providing pointer reallocate(pointer p, size_type old_n,
+  //size_type new_n): the block of p is resized, moved bytewise if needed
+  template<typename Alloc>
+  struct allocator_can_reallocate : public integral_constant<false> {};
+
+  //////////////////IS_CLASS//////////////////
+  //Class (or union) types, the ones that can be derived from
+  template<typename T>
+  struct is_class
+  {
+    private:
+      template<typename U>
+      static char test(int U::*);
+
+      template<typename U>
+      static long test(...);
+
+    public:
+      static const bool value = (sizeof(test<T>(0)) == 1);
+  };
+
   ////////////ARE SAME///////////////
   template<typename, typename>
   struct are_same
@@ -99,5 +161,23 @@ namespace ft
     }
     return true;
   }
+
+  /////////////////////BRANCHLESS_LOWER_BOUND/////////////////////////////
+  //lower_bound over n contiguous sorted elements. The trip count only
+  //depends on n and the step is a conditional move, so there is no
+  //mispredicted branch per level (used by the flat containers)
+  template <class T, class Key, class Compare>
+  const T *branchless_lower_bound(const T *first, size_t n, const Key &k, Compare comp)
+  {
+    if (n == 0)
+      return first;
+    while (n > 1)
+    {
+      const size_t half = n / 2;
+      first = comp(first[half], k) ? first + half : first;
+      n -= half;
+    }
+    return first + (comp(*first, k) ? 1 : 0);
+  }
 }
 #endif
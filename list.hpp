@@ -0,0 +1,826 @@
+#ifndef LIST_HPP
+# define LIST_HPP
+
+# include <algorithm>
+# include <cstddef>
+# include <functional>
+# include <memory>
+# include "ft_iterator.hpp"
+# include "ft_utilities.hpp"
+
+namespace ft
+{
+	//LINKS OF A LIST NODE, the header of a list is one of them
+	//The helpers only relink nodes so they are shared by every list<T>
+	struct List_node_base
+	{
+		List_node_base	*next;
+		List_node_base	*prev;
+
+		//Links this node before pos
+		void	hook(List_node_base *pos)
+		{
+			next = pos;
+			prev = pos->prev;
+			pos->prev->next = this;
+			pos->prev = this;
+		}
+
+		void	unhook()
+		{
+			prev->next = next;
+			next->prev = prev;
+		}
+
+		//Moves [first, last) before pos, the three may belong to different lists
+		static void	transfer(List_node_base *pos, List_node_base *first, List_node_base *last)
+		{
+			List_node_base	*const tmp = pos->prev;
+
+			if (pos == last || first == last)
+				return ;
+			last->prev->next = pos;
+			first->prev->next = last;
+			pos->prev->next = first;
+			pos->prev = last->prev;
+			last->prev = first->prev;
+			first->prev = tmp;
+		}
+
+		//Exchanges the contents of two headers
+		static void	swap(List_node_base &x, List_node_base &y)
+		{
+			std::swap(x.next, y.next);
+			std::swap(x.prev, y.prev);
+			if (x.next == &y)
+				x.next = x.prev = &x;
+			else
+				x.next->prev = x.prev->next = &x;
+			if (y.next == &x)
+				y.next = y.prev = &y;
+			else
+				y.next->prev = y.prev->next = &y;
+		}
+
+		//Reverses the ring this header belongs to
+		void	reverse()
+		{
+			List_node_base	*x = this;
+
+			do
+			{
+				std::swap(x->next, x->prev);
+				x = x->prev;
+			} while (x != this);
+		}
+	};
+
+	template<typename T>
+	struct List_node : public List_node_base
+	{
+		T	data;
+	};
+
+	template<typename T, typename Ref, typename Ptr>
+	struct List_iterator
+	{
+		typedef std::bidirectional_iterator_tag				iterator_category;
+		typedef T											value_type;
+		typedef ptrdiff_t									difference_type;
+		typedef Ptr											pointer;
+		typedef Ref											reference;
+		typedef List_iterator<T, T&, T*>					iterator;
+		typedef List_node<T>								node_type;
+
+		List_node_base	*node;
+
+		List_iterator() : node(0) {}
+
+		explicit List_iterator(const List_node_base *x)
+			: node(const_cast<List_node_base *>(x)) {}
+
+		//iterator to const_iterator
+		List_iterator(const iterator &x) : node(x.node) {}
+
+		reference	operator*() const
+		{ return (static_cast<node_type *>(node)->data); }
+
+		pointer	operator->() const
+		{ return (&static_cast<node_type *>(node)->data); }
+
+		List_iterator	&operator++()
+		{
+			node = node->next;
+			return (*this);
+		}
+
+		List_iterator	operator++(int)
+		{
+			List_iterator	tmp(*this);
+
+			node = node->next;
+			return (tmp);
+		}
+
+		List_iterator	&operator--()
+		{
+			node = node->prev;
+			return (*this);
+		}
+
+		List_iterator	operator--(int)
+		{
+			List_iterator	tmp(*this);
+
+			node = node->prev;
+			return (tmp);
+		}
+	};
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline bool	operator==(const List_iterator<T, RefL, PtrL> &x, const List_iterator<T, RefR, PtrR> &y)
+	{ return (x.node == y.node); }
+
+	template<typename T, typename RefL, typename PtrL, typename RefR, typename PtrR>
+	inline bool	operator!=(const List_iterator<T, RefL, PtrL> &x, const List_iterator<T, RefR, PtrR> &y)
+	{ return (x.node != y.node); }
+
+	//Doubly linked list around a header node stored in the object.
+	//Erased nodes are kept in a free list of their own (chained by next) and
+	//reused by the next insertions, so push/pop churn does not reach the
+	//allocator; clear() and shrink_to_fit() give them back. splice() and
+	//merge() relink the nodes of lists with equal allocators (copies of one
+	//ft::pool_allocator share its pool) and copy the elements otherwise.
+	//sort() only relinks nodes, it never allocates
+	template<typename T, typename Alloc = std::allocator<T> >
+	class list
+	{
+		public:
+			typedef T											value_type;
+			typedef typename Alloc::template rebind<T>::other	allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef List_iterator<T, T&, T*>					iterator;
+			typedef List_iterator<T, const T&, const T*>		const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef ptrdiff_t									difference_type;
+			typedef size_t										size_type;
+
+		private:
+			typedef List_node<T>										node_type;
+			typedef typename Alloc::template rebind<node_type>::other	Node_alloc;
+
+			Node_alloc		_node_alloc;
+			List_node_base	_header;
+			size_type		_size;
+			List_node_base	*_free;
+
+			static T	&_value(List_node_base *x)
+			{ return (static_cast<node_type *>(x)->data); }
+
+			void	_init_header()
+			{
+				_header.next = &_header;
+				_header.prev = &_header;
+			}
+
+			//////////////////////NODES////////////////////////
+			node_type	*_get_node()
+			{
+				if (_free == 0)
+					return (_node_alloc.allocate(1));
+				node_type	*x = static_cast<node_type *>(_free);
+
+				_free = _free->next;
+				return (x);
+			}
+
+			void	_put_node(List_node_base *x)
+			{
+				x->next = _free;
+				_free = x;
+			}
+
+			node_type	*_create_node(const value_type &val)
+			{
+				node_type	*x = _get_node();
+
+				try
+				{
+					get_allocator().construct(&x->data, val);
+				}
+				catch (...)
+				{
+					_put_node(x);
+					throw;
+				}
+				return (x);
+			}
+
+			void	_destroy_node(List_node_base *x)
+			{
+				get_allocator().destroy(&_value(x));
+				_put_node(x);
+			}
+
+			void	_release_free()
+			{
+				while (_free)
+				{
+					List_node_base	*next = _free->next;
+
+					_node_alloc.deallocate(static_cast<node_type *>(_free), 1);
+					_free = next;
+				}
+			}
+
+			//Unlinks then destroys, the node goes to the free list
+			void	_erase_node(List_node_base *x)
+			{
+				x->unhook();
+				--_size;
+				_destroy_node(x);
+			}
+
+			//Destroys the nodes of a detached ring, tmp is its header
+			void	_destroy_ring(List_node_base &tmp)
+			{
+				while (tmp.next != &tmp)
+				{
+					List_node_base	*x = tmp.next;
+
+					x->unhook();
+					_destroy_node(x);
+				}
+			}
+
+			//Builds the n nodes in a detached ring first so nothing is inserted
+			//when a copy throws
+			template<typename Iterator>
+			void	_insert_range(iterator position, Iterator first, Iterator last)
+			{
+				List_node_base	tmp;
+				size_type		n = 0;
+
+				tmp.next = &tmp;
+				tmp.prev = &tmp;
+				try
+				{
+					for (; first != last; ++first, ++n)
+						_create_node(*first)->hook(&tmp);
+				}
+				catch (...)
+				{
+					_destroy_ring(tmp);
+					throw;
+				}
+				List_node_base::transfer(position.node, tmp.next, &tmp);
+				_size += n;
+			}
+
+			void	_fill_insert(iterator position, size_type n, const value_type &val)
+			{
+				List_node_base	tmp;
+				size_type		i = 0;
+
+				tmp.next = &tmp;
+				tmp.prev = &tmp;
+				try
+				{
+					for (; i < n; ++i)
+						_create_node(val)->hook(&tmp);
+				}
+				catch (...)
+				{
+					_destroy_ring(tmp);
+					throw;
+				}
+				List_node_base::transfer(position.node, tmp.next, &tmp);
+				_size += n;
+			}
+
+			template<typename Integral>
+			void	_dispatch_insert(iterator position, Integral n, Integral val, true_type)
+			{ _fill_insert(position, static_cast<size_type>(n), static_cast<value_type>(val)); }
+
+			template<typename Iterator>
+			void	_dispatch_insert(iterator position, Iterator first, Iterator last, false_type)
+			{ _insert_range(position, first, last); }
+
+			template<typename Integral>
+			void	_dispatch_assign(Integral n, Integral val, true_type)
+			{ assign(static_cast<size_type>(n), static_cast<value_type>(val)); }
+
+			//Assigns over the existing elements, then trims or appends the rest
+			template<typename Iterator>
+			void	_dispatch_assign(Iterator first, Iterator last, false_type)
+			{
+				iterator	cur = begin();
+
+				for (; first != last && cur != end(); ++first, ++cur)
+					*cur = *first;
+				if (first == last)
+					erase(cur, end());
+				else
+					_insert_range(end(), first, last);
+			}
+
+			//Nodes may only move to a list that frees them the same way
+			bool	_same_alloc(const list &x) const
+			{ return (_node_alloc == x._node_alloc); }
+
+			//Merges two sorted chains ended by null next pointers, a first on
+			//ties. Prev pointers are left to the caller
+			template<typename Compare>
+			static List_node_base	*_merge_chains(List_node_base *a, List_node_base *b, Compare &comp)
+			{
+				List_node_base	head;
+				List_node_base	*tail = &head;
+
+				while (a && b)
+				{
+					if (comp(_value(b), _value(a)))
+					{
+						tail->next = b;
+						b = b->next;
+					}
+					else
+					{
+						tail->next = a;
+						a = a->next;
+					}
+					tail = tail->next;
+				}
+				tail->next = (a ? a : b);
+				return (head.next);
+			}
+
+		public:
+			//////////////////////CONSTRUCTORS//////////////////
+			explicit list(const allocator_type &alloc = allocator_type())
+				: _node_alloc(alloc), _size(0), _free(0)
+			{ _init_header(); }
+
+			explicit list(size_type n, const value_type &val = value_type(),
+				const allocator_type &alloc = allocator_type())
+				: _node_alloc(alloc), _size(0), _free(0)
+			{
+				_init_header();
+				try
+				{
+					_fill_insert(end(), n, val);
+				}
+				catch (...)
+				{
+					_release_free();
+					throw;
+				}
+			}
+
+			template<typename Iterator>
+			list(Iterator first, Iterator last, const allocator_type &alloc = allocator_type())
+				: _node_alloc(alloc), _size(0), _free(0)
+			{
+				ft::is_integral<Iterator>	Integral;
+
+				_init_header();
+				try
+				{
+					_dispatch_insert(end(), first, last, Integral);
+				}
+				catch (...)
+				{
+					_release_free();
+					throw;
+				}
+			}
+
+			list(const list &src)
+				: _node_alloc(src._node_alloc), _size(0), _free(0)
+			{
+				_init_header();
+				try
+				{
+					_insert_range(end(), src.begin(), src.end());
+				}
+				catch (...)
+				{
+					_release_free();
+					throw;
+				}
+			}
+
+			~list()
+			{ clear(); }
+
+			list	&operator=(const list &src)
+			{
+				if (this != &src)
+					_dispatch_assign(src.begin(), src.end(), false_type());
+				return (*this);
+			}
+
+			void	assign(size_type n, const value_type &val)
+			{
+				iterator	cur = begin();
+
+				for (; n && cur != end(); --n, ++cur)
+					*cur = val;
+				if (n == 0)
+					erase(cur, end());
+				else
+					_fill_insert(end(), n, val);
+			}
+
+			template<typename Iterator>
+			void	assign(Iterator first, Iterator last)
+			{
+				ft::is_integral<Iterator>	Integral;
+
+				_dispatch_assign(first, last, Integral);
+			}
+
+			allocator_type	get_allocator() const
+			{ return (allocator_type(_node_alloc)); }
+
+			//////////////////////ITERATORS////////////////////////
+			iterator	begin()
+			{ return (iterator(_header.next)); }
+
+			const_iterator	begin() const
+			{ return (const_iterator(_header.next)); }
+
+			iterator	end()
+			{ return (iterator(&_header)); }
+
+			const_iterator	end() const
+			{ return (const_iterator(&_header)); }
+
+			reverse_iterator	rbegin()
+			{ return (reverse_iterator(end())); }
+
+			const_reverse_iterator	rbegin() const
+			{ return (const_reverse_iterator(end())); }
+
+			reverse_iterator	rend()
+			{ return (reverse_iterator(begin())); }
+
+			const_reverse_iterator	rend() const
+			{ return (const_reverse_iterator(begin())); }
+
+			//////////////////////CAPACITY////////////////////////
+			bool	empty() const
+			{ return (_size == 0); }
+
+			size_type	size() const
+			{ return (_size); }
+
+			size_type	max_size() const
+			{ return (_node_alloc.max_size()); }
+
+			//Frees the nodes kept for reuse
+			void	shrink_to_fit()
+			{ _release_free(); }
+
+			//////////////////////ELEMENT_ACCESS////////////////////////
+			reference	front()
+			{ return (_value(_header.next)); }
+
+			const_reference	front() const
+			{ return (_value(_header.next)); }
+
+			reference	back()
+			{ return (_value(_header.prev)); }
+
+			const_reference	back() const
+			{ return (_value(_header.prev)); }
+
+			//////////////////////MODIFIERS////////////////////////
+			void	push_front(const value_type &val)
+			{
+				_create_node(val)->hook(_header.next);
+				++_size;
+			}
+
+			void	pop_front()
+			{ _erase_node(_header.next); }
+
+			void	push_back(const value_type &val)
+			{
+				_create_node(val)->hook(&_header);
+				++_size;
+			}
+
+			void	pop_back()
+			{ _erase_node(_header.prev); }
+
+			iterator	insert(iterator position, const value_type &val)
+			{
+				node_type	*x = _create_node(val);
+
+				x->hook(position.node);
+				++_size;
+				return (iterator(x));
+			}
+
+			void	insert(iterator position, size_type n, const value_type &val)
+			{ _fill_insert(position, n, val); }
+
+			template<typename Iterator>
+			void	insert(iterator position, Iterator first, Iterator last)
+			{
+				ft::is_integral<Iterator>	Integral;
+
+				_dispatch_insert(position, first, last, Integral);
+			}
+
+			iterator	erase(iterator position)
+			{
+				iterator	next(position.node->next);
+
+				_erase_node(position.node);
+				return (next);
+			}
+
+			iterator	erase(iterator first, iterator last)
+			{
+				while (first != last)
+					first = erase(first);
+				return (last);
+			}
+
+			void	swap(list &x)
+			{
+				List_node_base::swap(_header, x._header);
+				std::swap(_size, x._size);
+				std::swap(_free, x._free);
+				std::swap(_node_alloc, x._node_alloc);
+			}
+
+			void	resize(size_type n, value_type val = value_type())
+			{
+				if (n >= _size)
+					_fill_insert(end(), n - _size, val);
+				else
+				{
+					iterator	first = end();
+
+					for (size_type i = _size - n; i; --i)
+						--first;
+					erase(first, end());
+				}
+			}
+
+			//Destroys the elements and frees every node, reused ones included
+			void	clear()
+			{
+				List_node_base	*x = _header.next;
+
+				while (x != &_header)
+				{
+					List_node_base	*next = x->next;
+
+					_destroy_node(x);
+					x = next;
+				}
+				_init_header();
+				_size = 0;
+				_release_free();
+			}
+
+			//////////////////////OPERATIONS////////////////////////
+			//Moves nodes from x before position, no element is copied unless
+			//the allocators differ
+			void	splice(iterator position, list &x)
+			{
+				if (x.empty())
+					return ;
+				if (!_same_alloc(x))
+				{
+					_insert_range(position, x.begin(), x.end());
+					x.erase(x.begin(), x.end());
+					return ;
+				}
+				List_node_base::transfer(position.node, x._header.next, &x._header);
+				_size += x._size;
+				x._size = 0;
+			}
+
+			void	splice(iterator position, list &x, iterator i)
+			{
+				List_node_base	*next = i.node->next;
+
+				if (position.node == i.node || position.node == next)
+					return ;
+				if (!_same_alloc(x))
+				{
+					insert(position, *i);
+					x.erase(i);
+					return ;
+				}
+				List_node_base::transfer(position.node, i.node, next);
+				++_size;
+				--x._size;
+			}
+
+			//O(1) within a list, counts the moved nodes between two lists
+			void	splice(iterator position, list &x, iterator first, iterator last)
+			{
+				if (first == last)
+					return ;
+				if (!_same_alloc(x))
+				{
+					_insert_range(position, first, last);
+					x.erase(first, last);
+					return ;
+				}
+				if (this != &x)
+				{
+					size_type	n = 0;
+
+					for (iterator it = first; it != last; ++it)
+						++n;
+					_size += n;
+					x._size -= n;
+				}
+				List_node_base::transfer(position.node, first.node, last.node);
+			}
+
+			//val may be an element of the list, its node goes last
+			void	remove(const value_type &val)
+			{
+				List_node_base	*x = _header.next;
+				List_node_base	*self = 0;
+
+				while (x != &_header)
+				{
+					List_node_base	*next = x->next;
+
+					if (_value(x) == val)
+					{
+						if (&_value(x) != &val)
+							_erase_node(x);
+						else
+							self = x;
+					}
+					x = next;
+				}
+				if (self)
+					_erase_node(self);
+			}
+
+			template<typename Predicate>
+			void	remove_if(Predicate pred)
+			{
+				List_node_base	*x = _header.next;
+
+				while (x != &_header)
+				{
+					List_node_base	*next = x->next;
+
+					if (pred(_value(x)))
+						_erase_node(x);
+					x = next;
+				}
+			}
+
+			void	unique()
+			{ unique(std::equal_to<value_type>()); }
+
+			template<typename BinaryPredicate>
+			void	unique(BinaryPredicate pred)
+			{
+				List_node_base	*x = _header.next;
+
+				if (x == &_header)
+					return ;
+				while (x->next != &_header)
+				{
+					if (pred(_value(x), _value(x->next)))
+						_erase_node(x->next);
+					else
+						x = x->next;
+				}
+			}
+
+			void	merge(list &x)
+			{ merge(x, std::less<value_type>()); }
+
+			//Stable, the elements of x go after the equal ones of this list
+			template<typename Compare>
+			void	merge(list &x, Compare comp)
+			{
+				List_node_base	*first1 = _header.next;
+				List_node_base	*first2 = x._header.next;
+
+				if (this == &x)
+					return ;
+				if (!_same_alloc(x))
+				{
+					list	tmp(x.begin(), x.end(), get_allocator());
+
+					merge(tmp, comp);
+					x.erase(x.begin(), x.end());
+					return ;
+				}
+				while (first1 != &_header && first2 != &x._header)
+				{
+					if (comp(_value(first2), _value(first1)))
+					{
+						List_node_base	*next = first2->next;
+
+						List_node_base::transfer(first1, first2, next);
+						first2 = next;
+					}
+					else
+						first1 = first1->next;
+				}
+				if (first2 != &x._header)
+					List_node_base::transfer(&_header, first2, &x._header);
+				_size += x._size;
+				x._size = 0;
+			}
+
+			void	sort()
+			{ sort(std::less<value_type>()); }
+
+			//Stable bottom-up merge sort on the links: bins[i] holds a sorted
+			//run of 2^i nodes, every new node carries up through the full bins
+			template<typename Compare>
+			void	sort(Compare comp)
+			{
+				List_node_base	*bins[64];
+				size_t			fill = 0;
+				List_node_base	*x = _header.next;
+				List_node_base	*result = 0;
+
+				if (_size < 2)
+					return ;
+				_header.prev->next = 0;
+				while (x)
+				{
+					List_node_base	*carry = x;
+					size_t			i = 0;
+
+					x = x->next;
+					carry->next = 0;
+					for (; i < fill && bins[i]; ++i)
+					{
+						carry = _merge_chains(bins[i], carry, comp);
+						bins[i] = 0;
+					}
+					bins[i] = carry;
+					if (i == fill)
+						++fill;
+				}
+				for (size_t i = 0; i < fill; ++i)
+					if (bins[i])
+						result = (result ? _merge_chains(bins[i], result, comp) : bins[i]);
+				x = &_header;
+				for (; result; result = result->next)
+				{
+					x->next = result;
+					result->prev = x;
+					x = result;
+				}
+				x->next = &_header;
+				_header.prev = x;
+			}
+
+			void	reverse()
+			{ _header.reverse(); }
+	};
+
+	template<typename T, typename Alloc>
+	inline bool	operator==(const list<T, Alloc> &x, const list<T, Alloc> &y)
+	{ return (x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin())); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator!=(const list<T, Alloc> &x, const list<T, Alloc> &y)
+	{ return (!(x == y)); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator<(const list<T, Alloc> &x, const list<T, Alloc> &y)
+	{ return (ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end())); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator>(const list<T, Alloc> &x, const list<T, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator<=(const list<T, Alloc> &x, const list<T, Alloc> &y)
+	{ return (!(y < x)); }
+
+	template<typename T, typename Alloc>
+	inline bool	operator>=(const list<T, Alloc> &x, const list<T, Alloc> &y)
+	{ return (!(x < y)); }
+
+	template<typename T, typename Alloc>
+	inline void	swap(list<T, Alloc> &x, list<T, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
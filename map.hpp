@@ -61,6 +61,7 @@ namespace ft
 			typedef typename _Rb_tree::const_reverse_iterator				const_reverse_iterator;
 			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
 			typedef typename _Rb_tree::size_type							size_type;
+			typedef typename _Rb_tree::node_type							node_type;
 
 			//CONSTRUCTORS, OPERATOR=
 
@@ -136,6 +137,17 @@ namespace ft
 			void	insert(Iterator first, Iterator last)
 			{ _rb_tree.insert_unique(first, last); }
 
+			//Relinks an extracted node, nh keeps it if the key exists
+			ft::pair<iterator, bool>	insert(const node_type &nh)
+			{ return _rb_tree.insert_unique(nh); }
+
+			//Unlinks an element without freeing it (see node_type)
+			node_type	extract(iterator position)
+			{ return _rb_tree.extract(position); }
+
+			node_type	extract(const key_type &k)
+			{ return _rb_tree.extract(k); }
+
 			void	erase(iterator position)
 			{ _rb_tree.erase(position); }
 
@@ -151,6 +163,19 @@ namespace ft
 			void clear()
 			{ _rb_tree.clear(); }
 
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+			//Moves every element whose key is not lesser than k into upper
+			//(previous content cleared), nodes are relinked in O(log n).
+			//Needs FT_RB_TREE_ORDER_STATISTICS, which gives the moved count
+			void	split(const key_type &k, map &upper)
+			{ _rb_tree.split(k, upper._rb_tree); }
+# endif
+
+			//Appends upper, whose keys must all be greater, in O(log n).
+			//Returns false and changes nothing when the keys overlap
+			bool	join(map &upper)
+			{ return (_rb_tree.join(upper._rb_tree)); }
+
 			//OBSERVERS
 			key_compare	key_comp() const
 			{ return _rb_tree.key_comp(); }
@@ -186,6 +211,24 @@ namespace ft
 			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
 			{ return _rb_tree.equal_range(k); }
 
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+			//ORDER STATISTICS, O(log n)
+			size_type	rank(const key_type &k) const
+			{ return _rb_tree.rank(k); }
+
+			iterator	select(size_type k)
+			{ return _rb_tree.select(k); }
+
+			const_iterator	select(size_type k) const
+			{ return _rb_tree.select(k); }
+
+			size_type	count_range(const key_type &lo, const key_type &hi) const
+			{ return _rb_tree.count_range(lo, hi); }
+
+			size_type	size(const_iterator first, const_iterator last) const
+			{ return _rb_tree.size(first, last); }
+# endif
+
 			//ALLOCATOR
 			allocator_type	get_allocator() const
 			{ return _rb_tree.get_allocator(); }
@@ -0,0 +1,254 @@
+#ifndef MULTIMULTIMAP_HPP
+# define MULTIMULTIMAP_HPP
+
+# include <functional>
+# include <memory>
+# include "ft_rbtree.hpp"
+# include "map.hpp"
+
+namespace ft
+{
+	//Map allowing equal keys, kept in insertion order among themselves
+	template
+	<
+		typename Key,
+		typename Value,
+		typename Compare = std::less<Key>,
+		typename Alloc = std::allocator<ft::pair <const Key, Value> >
+	>
+	class multimap
+	{
+		public:
+			typedef Key								key_type;
+			typedef	Value							mapped_type;
+			typedef ft::pair<const Key, Value>		value_type;
+			typedef Compare							key_compare;
+			typedef Alloc							allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef Rb_tree<key_type, value_type, ft::Select1st<value_type>, key_compare, allocator_type>	_Rb_tree;
+			_Rb_tree _rb_tree;
+
+		public:
+			class value_compare : public std::binary_function<value_type, value_type, bool>
+			{
+				friend class multimap<Key, Value, Compare, Alloc>;
+
+				protected:
+					Compare	comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					bool	operator()(const value_type &x, const value_type &y) const
+					{ return comp(x.first, y.first); }
+			};
+
+			typedef typename _Rb_tree::iterator								iterator;
+			typedef typename _Rb_tree::const_iterator						const_iterator;
+			typedef typename _Rb_tree::reverse_iterator						reverse_iterator;
+			typedef typename _Rb_tree::const_reverse_iterator				const_reverse_iterator;
+			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+			typedef typename _Rb_tree::size_type							size_type;
+			typedef typename _Rb_tree::node_type							node_type;
+
+			//CONSTRUCTORS, OPERATOR=
+
+			explicit multimap(const key_compare &comp = key_compare(),
+				const allocator_type &alloc = allocator_type())
+				: _rb_tree(comp, alloc) {}
+
+			multimap(const multimap &src) : _rb_tree(src._rb_tree) {}
+
+			template<typename Iterator>
+			multimap(Iterator first, Iterator last,
+				const key_compare &comp = key_compare(),
+				const allocator_type &alloc = allocator_type())
+				: _rb_tree(comp, alloc)
+			{ _rb_tree.insert_equal(first, last); }
+
+			multimap&	operator=(const multimap &src)
+			{
+				_rb_tree = src._rb_tree;
+				return (*this);
+			}
+			//ITERATORS
+			iterator begin()
+			{ return _rb_tree.begin(); }
+
+			const_iterator begin() const
+			{ return _rb_tree.begin(); }
+
+			iterator end()
+			{ return _rb_tree.end(); }
+
+			const_iterator end() const
+			{ return _rb_tree.end(); }
+
+			reverse_iterator rbegin()
+			{ return _rb_tree.rbegin(); }
+
+			const_reverse_iterator rbegin() const
+			{ return _rb_tree.rbegin(); }
+
+			reverse_iterator rend()
+			{ return _rb_tree.rend(); }
+
+			const_reverse_iterator rend()  const
+			{ return _rb_tree.rend(); }
+
+			//CAPACITY
+			bool empty() const
+			{ return _rb_tree.empty(); }
+
+			size_type	max_size() const
+			{ return _rb_tree.max_size(); }
+
+			size_type	size() const
+			{ return _rb_tree.size(); }
+
+			//MODIFIERS
+			iterator	insert(const value_type &val)
+			{ return _rb_tree.insert_equal(val); }
+
+			//O(1) amortized when val belongs right before position, such as
+			//appending keys not lesser than the last one with end()
+			iterator	insert(iterator position, const value_type &val)
+			{ return _rb_tree.insert_equal(position, val); }
+
+			template<typename Iterator>
+			void	insert(Iterator first, Iterator last)
+			{ _rb_tree.insert_equal(first, last); }
+
+			//Relinks an extracted node after its equals
+			iterator	insert(const node_type &nh)
+			{ return _rb_tree.insert_equal(nh); }
+
+			//Unlinks an element without freeing it (see node_type), the first
+			//of its equals for a key
+			node_type	extract(iterator position)
+			{ return _rb_tree.extract(position); }
+
+			node_type	extract(const key_type &k)
+			{ return _rb_tree.extract(k); }
+
+			void	erase(iterator position)
+			{ _rb_tree.erase(position); }
+
+			size_type	erase(const key_type &k)
+			{ return _rb_tree.erase(k); }
+
+			void	erase(iterator first, iterator last)
+			{ _rb_tree.erase(first, last); }
+
+			void	swap(multimap &s)
+			{ _rb_tree.swap(s._rb_tree); }
+
+			void clear()
+			{ _rb_tree.clear(); }
+
+			//OBSERVERS
+			key_compare	key_comp() const
+			{ return _rb_tree.key_comp(); }
+
+			value_compare	value_comp() const
+			{ return value_compare(_rb_tree.key_comp()); }
+
+			//OPERATIONS
+			iterator find (const key_type &k)
+			{ return _rb_tree.find(k); }
+
+			const_iterator find (const key_type &k) const
+			{ return _rb_tree.find(k); }
+
+			//O(log n + count)
+			size_type	count(const key_type &k) const
+			{ return _rb_tree.count(k); }
+
+			iterator lower_bound(const key_type &k)
+			{ return _rb_tree.lower_bound(k); }
+
+			const_iterator lower_bound(const key_type &k) const
+			{ return _rb_tree.lower_bound(k); }
+
+			iterator upper_bound(const key_type &k)
+			{ return _rb_tree.upper_bound(k); }
+
+			const_iterator upper_bound(const key_type &k) const
+			{ return _rb_tree.upper_bound(k); }
+
+			ft::pair<iterator, iterator>	equal_range(const key_type &k)
+			{ return _rb_tree.equal_range(k); }
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+			{ return _rb_tree.equal_range(k); }
+
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+			//ORDER STATISTICS, O(log n)
+			size_type	rank(const key_type &k) const
+			{ return _rb_tree.rank(k); }
+
+			iterator	select(size_type k)
+			{ return _rb_tree.select(k); }
+
+			const_iterator	select(size_type k) const
+			{ return _rb_tree.select(k); }
+
+			size_type	count_range(const key_type &lo, const key_type &hi) const
+			{ return _rb_tree.count_range(lo, hi); }
+
+			size_type	size(const_iterator first, const_iterator last) const
+			{ return _rb_tree.size(first, last); }
+# endif
+
+			//ALLOCATOR
+			allocator_type	get_allocator() const
+			{ return _rb_tree.get_allocator(); }
+
+			//Friend prototype to have access to private _rb_tree outside
+			template<typename K, typename T, typename C, typename A>
+			friend bool	operator==(const multimap<K, T, C, A>&, const multimap<K, T, C, A>&);
+
+			template<typename K, typename T, typename C, typename A>
+			friend bool	operator<(const multimap<K, T, C, A>&, const multimap<K, T, C, A>&);
+	};
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator==(const multimap<Key, Tp, Compare, Alloc> &x,
+		const multimap<Key, Tp, Compare, Alloc> &y)
+	{ return (x._rb_tree == y._rb_tree); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator<(const multimap<Key, Tp, Compare, Alloc> &x,
+		const multimap<Key, Tp, Compare, Alloc> &y)
+	{ return (x._rb_tree < y._rb_tree); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator!=(const multimap<Key, Tp, Compare, Alloc> &x,
+		const multimap<Key, Tp, Compare, Alloc> &y)
+	{ return !(x == y); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator>(const multimap<Key, Tp, Compare, Alloc> &x,
+		const multimap<Key, Tp, Compare, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator<=(const multimap<Key, Tp, Compare, Alloc> &x,
+		const multimap<Key, Tp, Compare, Alloc> &y)
+	{ return !(y < x); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline bool operator>=(const multimap<Key, Tp, Compare, Alloc> &x,
+		const multimap<Key, Tp, Compare, Alloc> &y)
+	{ return !(x < y); }
+
+	template<typename Key, typename Tp, typename Compare, typename Alloc>
+	inline void swap(multimap<Key, Tp, Compare, Alloc> &x, multimap<Key, Tp, Compare, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
@@ -0,0 +1,233 @@
+#ifndef MULTIMULTISET_HPP
+# define MULTIMULTISET_HPP
+
+# include <functional>
+# include <memory>
+# include "ft_iterator.hpp"
+# include "ft_rbtree.hpp"
+# include "ft_utilities.hpp"
+# include "set.hpp"
+
+namespace	ft
+{
+	//Set allowing equal elements, kept in insertion order among themselves
+	template
+	<
+		typename Key,
+		typename Compare = std::less<Key>,
+		typename Alloc = std::allocator<Key>
+	>
+	class multiset
+	{
+		public:
+			typedef Key		key_type;
+			typedef Key		value_type;
+			typedef Compare	key_compare;
+			typedef	Compare	value_compare;
+			typedef Alloc	allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef Rb_tree<key_type, value_type, ft::Identity<value_type>, key_compare, allocator_type>	_Rb_tree;
+			_Rb_tree _rb_tree;
+		public:
+			typedef typename _Rb_tree::const_iterator						iterator;
+			typedef typename _Rb_tree::const_iterator						const_iterator;
+			typedef typename _Rb_tree::const_reverse_iterator				reverse_iterator;
+			typedef typename _Rb_tree::const_reverse_iterator				const_reverse_iterator;
+			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+			typedef typename _Rb_tree::size_type							size_type;
+			typedef typename _Rb_tree::node_type							node_type;
+		//Constructor and operator=
+		explicit	multiset(const Compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type())
+			: _rb_tree(comp, alloc) {}
+
+		template <typename It>
+		multiset(It first, It last, const Compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type())
+			: _rb_tree(comp, alloc)
+		{ _rb_tree.insert_equal(first, last); }
+
+		multiset(const multiset &x) : _rb_tree(x._rb_tree) {}
+
+		multiset&	operator=(const multiset &src)
+		{
+			_rb_tree = src._rb_tree;
+			return *this;
+		}
+		//Accessors
+		key_compare	key_comp() const
+		{ return _rb_tree.key_comp(); }
+
+		value_compare	value_comp() const
+		{ return _rb_tree.key_comp(); }
+
+		//Iterators
+		iterator	begin()
+		{ return _rb_tree.begin(); }
+
+		const_iterator	begin() const
+		{ return _rb_tree.begin(); }
+
+		iterator	end()
+		{ return _rb_tree.end(); }
+
+		const_iterator	end() const
+		{ return _rb_tree.end(); }
+
+		reverse_iterator	rbegin()
+		{ return _rb_tree.rbegin(); }
+
+		const_reverse_iterator	rbegin() const
+		{ return _rb_tree.rbegin(); }
+
+		reverse_iterator	rend()
+		{ return _rb_tree.rend(); }
+
+		const_reverse_iterator	rend() const
+		{ return _rb_tree.rend(); }
+		//Capacity
+		bool	empty() const
+		{ return _rb_tree.empty(); }
+
+		size_type	size() const
+		{ return _rb_tree.size(); }
+
+		size_type	max_size() const
+		{ return _rb_tree.max_size(); }
+		//Modifiers
+		void	swap(multiset &x)
+		{ _rb_tree.swap(x._rb_tree); }
+
+		iterator	insert(const value_type &val)
+		{ return _rb_tree.insert_equal(val); }
+
+		//O(1) amortized when val belongs right before position, such as
+		//appending values not lesser than the last one with end()
+		iterator	insert(iterator position, const value_type &val)
+		{ return _rb_tree.insert_equal(position, val); }
+
+		template<typename It>
+		void	insert(It first, It last)
+		{ _rb_tree.insert_equal(first, last); }
+
+		//Relinks an extracted node after its equals
+		iterator	insert(const node_type &nh)
+		{ return _rb_tree.insert_equal(nh); }
+
+		//Unlinks an element without freeing it (see node_type), the first
+		//of its equals for a value
+		node_type	extract(iterator position)
+		{ return _rb_tree.extract(position); }
+
+		node_type	extract(const value_type &val)
+		{ return _rb_tree.extract(val); }
+
+		void	erase(iterator position)
+		{ _rb_tree.erase(position); }
+
+		size_type	erase(const value_type &val)
+		{ return _rb_tree.erase(val); }
+
+		void	erase(iterator first, iterator last)
+		{ return _rb_tree.erase(first, last); }
+
+		void	clear()
+		{ _rb_tree.clear(); }
+
+		//Operations
+		iterator	find(const value_type &val)
+		{ return _rb_tree.find(val); }
+
+		const_iterator	find(const value_type &val) const
+		{ return _rb_tree.find(val); }
+
+		//O(log n + count)
+		size_type	count(const value_type &val) const
+		{ return _rb_tree.count(val); }
+
+		iterator	lower_bound(const value_type &val)
+		{ return _rb_tree.lower_bound(val); }
+
+		const_iterator	lower_bound(const value_type &val) const
+		{ return _rb_tree.lower_bound(val); }
+
+		iterator	upper_bound(const value_type &val)
+		{ return _rb_tree.upper_bound(val); }
+
+		const_iterator	upper_bound(const value_type &val) const
+		{ return _rb_tree.upper_bound(val); }
+
+		ft::pair<iterator, iterator>	equal_range(const value_type &val)
+		{ return _rb_tree.equal_range(val); }
+
+		ft::pair<const_iterator, const_iterator>	equal_range(const value_type &val) const
+		{ return _rb_tree.equal_range(val); }
+
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+		//Order statistics, O(log n)
+		size_type	rank(const value_type &val) const
+		{ return _rb_tree.rank(val); }
+
+		iterator	select(size_type k) const
+		{ return _rb_tree.select(k); }
+
+		size_type	count_range(const value_type &lo, const value_type &hi) const
+		{ return _rb_tree.count_range(lo, hi); }
+
+		size_type	size(const_iterator first, const_iterator last) const
+		{ return _rb_tree.size(first, last); }
+# endif
+
+		//Allocator
+		allocator_type	get_allocator() const
+		{ return _rb_tree.get_allocator(); }
+		//Friend prototype to have access to private _rb_tree outside
+		template<typename K, typename C, typename A>
+		friend bool	operator==(const multiset<K, C, A>&, const multiset<K, C, A>&);
+
+		template<typename K, typename C, typename A>
+		friend bool	operator<(const multiset<K, C, A>&, const multiset<K, C, A>&);
+	};
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator==(const multiset<Key, Compare, Alloc> &x,
+		const multiset<Key, Compare, Alloc> &y)
+	{ return (x._rb_tree == y._rb_tree); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator<(const multiset<Key, Compare, Alloc> &x,
+		const multiset<Key, Compare, Alloc> &y)
+	{ return (x._rb_tree < y._rb_tree); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator!=(const multiset<Key, Compare, Alloc> &x,
+		const multiset<Key, Compare, Alloc> &y)
+	{ return !(x == y); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator>(const multiset<Key, Compare, Alloc> &x,
+		const multiset<Key, Compare, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator<=(const multiset<Key, Compare, Alloc> &x,
+		const multiset<Key, Compare, Alloc> &y)
+	{ return !(y < x); }
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline bool operator>=(const multiset<Key, Compare, Alloc> &x,
+		const multiset<Key, Compare, Alloc> &y)
+	{ return !(x < y); }
+
+
+	template<typename Key, typename Compare, typename Alloc>
+	inline void swap(multiset<Key, Compare, Alloc> &x, multiset<Key, Compare, Alloc> &y)
+	{ x.swap(y); }
+}
+#endif
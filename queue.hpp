@@ -0,0 +1,424 @@
+#ifndef QUEUE_HPP
+# define QUEUE_HPP
+
+# include <functional>
+# include "deque.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	template<typename T, typename Container = ft::deque<T> >
+	class queue
+	{
+		template<typename T1, typename C1>
+		friend bool	operator==(const queue<T1, C1>&, const queue<T1, C1>&);
+
+		template<typename T1, typename C1>
+		friend bool	operator<(const queue<T1, C1>&, const queue<T1, C1>&);
+
+		public:
+			typedef typename Container::value_type			value_type;
+			typedef typename Container::reference			reference;
+			typedef typename Container::const_reference		const_reference;
+			typedef typename Container::size_type			size_type;
+			typedef Container								container_type;
+		protected:
+			container_type	c;
+		public:
+			//Constructor
+			explicit queue(const Container &_c = Container()) : c(_c) {}
+
+			bool empty() const
+			{ return c.empty(); }
+
+			size_type	size() const
+			{ return c.size(); }
+
+			reference	front()
+			{ return c.front(); }
+
+			const_reference	front() const
+			{ return c.front(); }
+
+			reference	back()
+			{ return c.back(); }
+
+			const_reference	back() const
+			{ return c.back(); }
+
+			void	push(const value_type &val)
+			{ c.push_back(val); }
+
+			void	pop()
+			{ c.pop_front(); }
+	};
+
+	template<typename T, typename C>
+	inline bool	operator<(const queue<T,C> &x, const queue<T,C> &y)
+	{ return x.c < y.c; }
+
+	template<typename T, typename C>
+	inline bool	operator==(const queue<T,C> &x, const queue<T,C> &y)
+	{ return x.c == y.c; }
+
+	template<typename T, typename C>
+	inline bool	operator!=(const queue<T,C> &x, const queue<T,C> &y)
+	{ return !(x == y); }
+
+	template<typename T, typename C>
+	inline bool	operator>(const queue<T,C> &x, const queue<T,C> &y)
+	{ return y < x;}
+
+	template<typename T, typename C>
+	inline bool	operator<=(const queue<T,C> &x, const queue<T,C> &y)
+	{ return !(y < x);}
+
+	template<typename T, typename C>
+	inline bool	operator>=(const queue<T,C> &x, const queue<T,C> &y)
+	{ return !(x < y);}
+
+	//D-ARY HEAP ON A RANDOM ACCESS RANGE
+	//Children of i are D * i + 1 to D * i + D. A wider node makes the heap
+	//log(D) times shallower and its children share one or two cache lines,
+	//so a sift touches fewer lines for a few more comparisons. Sifts move a
+	//hole instead of swapping, Moved(first, i) is called for every element
+	//landing on index i (a no-op outside indexed_priority_queue)
+	template<size_t D>
+	struct Dary_heap
+	{
+		struct No_moved
+		{
+			template<typename Iterator>
+			void	operator()(Iterator, size_t) const {}
+		};
+
+		template<typename Iterator, typename T, typename Compare, typename Moved>
+		static void	sift_up(Iterator first, size_t hole, const T &val, Compare &comp, Moved moved)
+		{
+			while (hole > 0)
+			{
+				const size_t	parent = (hole - 1) / D;
+
+				if (!comp(first[parent], val))
+					break ;
+				first[hole] = first[parent];
+				moved(first, hole);
+				hole = parent;
+			}
+			first[hole] = val;
+			moved(first, hole);
+		}
+
+		template<typename Iterator, typename T, typename Compare, typename Moved>
+		static void	sift_down(Iterator first, size_t len, size_t hole, const T &val, Compare &comp, Moved moved)
+		{
+			size_t	child;
+
+			while ((child = D * hole + 1) < len)
+			{
+				const size_t	last = (len - child < D ? len : child + D);
+				size_t			best = child;
+
+				for (++child; child < last; ++child)
+					if (comp(first[best], first[child]))
+						best = child;
+				if (!comp(val, first[best]))
+					break ;
+				first[hole] = first[best];
+				moved(first, hole);
+				hole = best;
+			}
+			first[hole] = val;
+			moved(first, hole);
+		}
+
+		//Refills the root after a pop: the hole goes down to a leaf along the
+		//best children, then val (the former last element, which belongs near
+		//the bottom) sifts up from there. Saves the comparison with val on
+		//every level of the way down
+		template<typename Iterator, typename T, typename Compare, typename Moved>
+		static void	pop_sift(Iterator first, size_t len, const T &val, Compare &comp, Moved moved)
+		{
+			size_t	hole = 0;
+			size_t	child;
+
+			while ((child = D * hole + 1) < len)
+			{
+				const size_t	last = (len - child < D ? len : child + D);
+				size_t			best = child;
+
+				for (++child; child < last; ++child)
+					if (comp(first[best], first[child]))
+						best = child;
+				first[hole] = first[best];
+				moved(first, hole);
+				hole = best;
+			}
+			sift_up(first, hole, val, comp, moved);
+		}
+
+		//Floyd's bottom-up construction, O(n)
+		template<typename Iterator, typename Compare, typename Moved>
+		static void	make_heap(Iterator first, size_t len, Compare &comp, Moved moved)
+		{
+			if (len < 2)
+				return ;
+			for (size_t i = (len - 2) / D + 1; i-- > 0;)
+			{
+				typename ft::iterator_traits<Iterator>::value_type	val(first[i]);
+
+				sift_down(first, len, i, val, comp, moved);
+			}
+		}
+	};
+
+	//Max-heap (for Compare = std::less) stored in Container, a D-ary heap
+	//(4-ary by default, 2 gives the std::priority_queue layout)
+	template<typename T, typename Container = ft::vector<T>,
+		typename Compare = std::less<typename Container::value_type>, size_t D = 4>
+	class priority_queue
+	{
+		typedef Dary_heap<D>	Heap;
+
+		public:
+			typedef typename Container::value_type			value_type;
+			typedef typename Container::reference			reference;
+			typedef typename Container::const_reference		const_reference;
+			typedef typename Container::size_type			size_type;
+			typedef Container								container_type;
+			typedef Compare									value_compare;
+		protected:
+			container_type	c;
+			Compare			comp;
+		public:
+			//Constructor
+			explicit priority_queue(const Compare &_comp = Compare(), const Container &_c = Container())
+				: c(_c), comp(_comp)
+			{ Heap::make_heap(c.begin(), c.size(), comp, typename Heap::No_moved()); }
+
+			template<typename Iterator>
+			priority_queue(Iterator first, Iterator last, const Compare &_comp = Compare(),
+				const Container &_c = Container())
+				: c(_c), comp(_comp)
+			{
+				c.insert(c.end(), first, last);
+				Heap::make_heap(c.begin(), c.size(), comp, typename Heap::No_moved());
+			}
+
+			bool empty() const
+			{ return c.empty(); }
+
+			size_type	size() const
+			{ return c.size(); }
+
+			const_reference	top() const
+			{ return c.front(); }
+
+			void	push(const value_type &val)
+			{
+				c.push_back(val);
+				const value_type	last(c.back());
+
+				Heap::sift_up(c.begin(), c.size() - 1, last, comp, typename Heap::No_moved());
+			}
+
+			//Appends the range then restores the heap: sifting the new elements
+			//up one by one (k log n) or rebuilding all of it (n), whichever is
+			//cheaper
+			template<typename Iterator>
+			void	push_range(Iterator first, Iterator last)
+			{
+				const size_type	old_size = c.size();
+				size_type		added;
+				size_type		depth = 1;
+
+				c.insert(c.end(), first, last);
+				added = c.size() - old_size;
+				for (size_type n = c.size(); n > D; n /= D)
+					++depth;
+				if (added * depth < c.size())
+					for (size_type i = old_size; i < c.size(); ++i)
+					{
+						const value_type	val(c[i]);
+
+						Heap::sift_up(c.begin(), i, val, comp, typename Heap::No_moved());
+					}
+				else
+					Heap::make_heap(c.begin(), c.size(), comp, typename Heap::No_moved());
+			}
+
+			void	pop()
+			{
+				const value_type	val(c.back());
+
+				c.pop_back();
+				if (!c.empty())
+					Heap::pop_sift(c.begin(), c.size(), val, comp, typename Heap::No_moved());
+			}
+	};
+
+	//Priority queue whose elements can be reached again: push() returns a
+	//handle that stays valid until the element is popped or erased (handles
+	//are then reused). update() moves an element after its priority changed,
+	//decrease_key() is the cheaper form for a value that can only move toward
+	//the top (a smaller key with std::greater, the min-heap of a scheduler)
+	template<typename T, typename Compare = std::less<T>, size_t D = 4>
+	class indexed_priority_queue
+	{
+		public:
+			typedef T				value_type;
+			typedef const T&		const_reference;
+			typedef size_t			size_type;
+			typedef size_t			handle_type;
+			typedef Compare			value_compare;
+
+		private:
+			typedef Dary_heap<D>	Heap;
+
+			struct Entry
+			{
+				T			value;
+				handle_type	handle;
+
+				Entry(const T &v, handle_type h) : value(v), handle(h) {}
+			};
+
+			struct Entry_compare
+			{
+				Compare	comp;
+
+				explicit Entry_compare(const Compare &c) : comp(c) {}
+
+				bool	operator()(const Entry &x, const Entry &y)
+				{ return (comp(x.value, y.value)); }
+			};
+
+			//Keeps _pos in sync with the entries moved by the sifts
+			struct Track
+			{
+				ft::vector<size_type>	*pos;
+
+				explicit Track(ft::vector<size_type> &p) : pos(&p) {}
+
+				template<typename Iterator>
+				void	operator()(Iterator first, size_t i) const
+				{ (*pos)[first[i].handle] = i; }
+			};
+
+			static size_type	_npos()
+			{ return (size_type(-1)); }
+
+			ft::vector<Entry>		_heap;
+			ft::vector<size_type>	_pos;
+			ft::vector<handle_type>	_free;
+			Entry_compare			_comp;
+
+			//Re-sifts the entry at i in the direction its value requires
+			void	_fix(size_type i)
+			{
+				const Entry	e(_heap[i]);
+
+				if (i > 0 && _comp(_heap[(i - 1) / D], e))
+					Heap::sift_up(_heap.begin(), i, e, _comp, Track(_pos));
+				else
+					Heap::sift_down(_heap.begin(), _heap.size(), i, e, _comp, Track(_pos));
+			}
+
+			//Moves the last entry over i, then fixes it
+			void	_remove_at(size_type i)
+			{
+				_pos[_heap[i].handle] = _npos();
+				_free.push_back(_heap[i].handle);
+				if (i + 1 == _heap.size())
+				{
+					_heap.pop_back();
+					return ;
+				}
+				_heap[i] = _heap.back();
+				_pos[_heap[i].handle] = i;
+				_heap.pop_back();
+				_fix(i);
+			}
+
+		public:
+			explicit indexed_priority_queue(const Compare &comp = Compare())
+				: _comp(comp) {}
+
+			bool	empty() const
+			{ return (_heap.empty()); }
+
+			size_type	size() const
+			{ return (_heap.size()); }
+
+			const_reference	top() const
+			{ return (_heap.front().value); }
+
+			handle_type	top_handle() const
+			{ return (_heap.front().handle); }
+
+			bool	contains(handle_type h) const
+			{ return (h < _pos.size() && _pos[h] != _npos()); }
+
+			//The handle must be contained
+			const_reference	value(handle_type h) const
+			{ return (_heap[_pos[h]].value); }
+
+			handle_type	push(const value_type &val)
+			{
+				handle_type	h;
+
+				if (_free.empty())
+				{
+					h = _pos.size();
+					_pos.push_back(_npos());
+				}
+				else
+				{
+					h = _free.back();
+					_free.pop_back();
+				}
+				try
+				{
+					_heap.push_back(Entry(val, h));
+				}
+				catch (...)
+				{
+					_free.push_back(h);
+					throw;
+				}
+				Heap::sift_up(_heap.begin(), _heap.size() - 1, Entry(val, h), _comp, Track(_pos));
+				return (h);
+			}
+
+			void	pop()
+			{ _remove_at(0); }
+
+			void	erase(handle_type h)
+			{ _remove_at(_pos[h]); }
+
+			//val must not come after the current value in the heap order
+			void	decrease_key(handle_type h, const value_type &val)
+			{
+				const size_type	i = _pos[h];
+
+				Heap::sift_up(_heap.begin(), i, Entry(val, h), _comp, Track(_pos));
+			}
+
+			void	update(handle_type h, const value_type &val)
+			{
+				const size_type	i = _pos[h];
+
+				_heap[i].value = val;
+				_fix(i);
+			}
+
+			void	clear()
+			{
+				_heap.clear();
+				_pos.clear();
+				_free.clear();
+			}
+	};
+}
+
+#endif
@@ -49,6 +49,7 @@ namespace	ft
 			typedef typename _Rb_tree::const_reverse_iterator				const_reverse_iterator;
 			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
 			typedef typename _Rb_tree::size_type							size_type;
+			typedef typename _Rb_tree::node_type							node_type;
 		//Constructor and operator=
 		explicit	set(const Compare &comp = key_compare(),
 			const allocator_type &alloc = allocator_type())
@@ -121,6 +122,17 @@ namespace	ft
 		void	insert(It first, It last)
 		{ _rb_tree.insert_unique(first, last); }
 
+		//Relinks an extracted node, nh keeps it if the value exists
+		ft::pair<iterator, bool>	insert(const node_type &nh)
+		{ return _rb_tree.insert_unique(nh); }
+
+		//Unlinks an element without freeing it (see node_type)
+		node_type	extract(iterator position)
+		{ return _rb_tree.extract(position); }
+
+		node_type	extract(const value_type &val)
+		{ return _rb_tree.extract(val); }
+
 		void	erase(iterator position)
 		{ _rb_tree.erase(position); }
 
@@ -132,6 +144,19 @@ namespace	ft
 
 		void	clear()
 		{ _rb_tree.clear(); }
+
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+		//Moves every element not lesser than val into upper (previous
+		//content cleared), nodes are relinked in O(log n). Needs
+		//FT_RB_TREE_ORDER_STATISTICS, which gives the moved count
+		void	split(const value_type &val, set &upper)
+		{ _rb_tree.split(val, upper._rb_tree); }
+# endif
+
+		//Appends upper, whose elements must all be greater, in O(log n).
+		//Returns false and changes nothing when they overlap
+		bool	join(set &upper)
+		{ return (_rb_tree.join(upper._rb_tree)); }
 		//Operations
 		iterator	find(const value_type &val)
 		{ return _rb_tree.find(val); }
@@ -160,6 +185,21 @@ namespace	ft
 		ft::pair<const_iterator, const_iterator>	equal_range(const value_type &val) const
 		{ return _rb_tree.equal_range(val); }
 
+# ifdef FT_RB_TREE_ORDER_STATISTICS
+		//Order statistics, O(log n)
+		size_type	rank(const value_type &val) const
+		{ return _rb_tree.rank(val); }
+
+		iterator	select(size_type k) const
+		{ return _rb_tree.select(k); }
+
+		size_type	count_range(const value_type &lo, const value_type &hi) const
+		{ return _rb_tree.count_range(lo, hi); }
+
+		size_type	size(const_iterator first, const_iterator last) const
+		{ return _rb_tree.size(first, last); }
+# endif
+
 		//Allocator
 		allocator_type	get_allocator() const
 		{ return _rb_tree.get_allocator(); }
@@ -203,8 +243,7 @@ namespace	ft
 
 
 	template<typename Key, typename Compare, typename Alloc>
-	inline bool swap(const set<Key, Compare, Alloc> &x,
-		const set<Key, Compare, Alloc> &y)
+	inline void swap(set<Key, Compare, Alloc> &x, set<Key, Compare, Alloc> &y)
 	{ x.swap(y); }
 }
 #endif
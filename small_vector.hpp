@@ -0,0 +1,328 @@
+#ifndef SMALL_VECTOR_HPP
+# define SMALL_VECTOR_HPP
+
+# include <algorithm>
+# include <cstring>
+# include <memory>
+# include "ft_utilities.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+	//ALLOCATOR OWNING THE INLINE BUFFER OF A SMALL_VECTOR
+	//The first request for at most N elements is served from the buffer,
+	//everything else goes to Alloc. Lives inside the vector (which inherits
+	//its allocator), copies start with a free buffer of their own
+	template<typename T, size_t N, typename Alloc>
+	class Small_vector_allocator : public Alloc::template rebind<T>::other
+	{
+		typedef typename Alloc::template rebind<T>::other	Base;
+
+		template<typename U, size_t M, typename A>
+		friend class Small_vector_allocator;
+
+		public:
+			typedef typename Base::pointer		pointer;
+			typedef typename Base::size_type	size_type;
+
+			template<typename U>
+			struct rebind
+			{ typedef Small_vector_allocator<U, N, Alloc> other; };
+
+		private:
+			union Storage
+			{
+				char		bytes[N * sizeof(T)];
+				long double	align_ld;
+				long long	align_ll;
+				void		*align_p;
+			};
+
+			Storage	_buffer;
+			bool	_in_use;
+
+		public:
+			Small_vector_allocator() : Base(), _in_use(false) {}
+
+			explicit Small_vector_allocator(const Alloc &a)
+				: Base(a), _in_use(false) {}
+
+			Small_vector_allocator(const Small_vector_allocator &src)
+				: Base(src), _in_use(false) {}
+
+			template<typename U>
+			Small_vector_allocator(const Small_vector_allocator<U, N, Alloc> &src)
+				: Base(static_cast<const typename Small_vector_allocator<U, N, Alloc>::Base &>(src)),
+				_in_use(false) {}
+
+			//The buffer belongs to one vector, assignment keeps it
+			Small_vector_allocator	&operator=(const Small_vector_allocator &src)
+			{
+				Base::operator=(src);
+				return (*this);
+			}
+
+			pointer	inline_data()
+			{ return (reinterpret_cast<pointer>(_buffer.bytes)); }
+
+			bool	is_inline(const T *p) const
+			{ return (p == reinterpret_cast<const T *>(_buffer.bytes)); }
+
+			pointer	allocate(size_type n, const void *hint = 0)
+			{
+				if (!_in_use && n <= N)
+				{
+					_in_use = true;
+					return (inline_data());
+				}
+				return (Base::allocate(n, hint));
+			}
+
+			void	deallocate(pointer p, size_type n)
+			{
+				if (is_inline(p))
+					_in_use = false;
+				else
+					Base::deallocate(p, n);
+			}
+
+			//Only called when Alloc can reallocate (see allocator_can_reallocate
+			//below): heap blocks go to Alloc, the inline buffer is copied out
+			pointer	reallocate(pointer p, size_type old_n, size_type new_n)
+			{
+				if (p != 0 && !is_inline(p))
+					return (Base::reallocate(p, old_n, new_n));
+				pointer	q = allocate(new_n);
+
+				if (p != 0)
+				{
+					std::memcpy(static_cast<void *>(q), static_cast<const void *>(p),
+						(old_n < new_n ? old_n : new_n) * sizeof(T));
+					deallocate(p, old_n);
+				}
+				return (q);
+			}
+
+			//Used by small_vector::swap to hand the buffer over
+			void	set_in_use(bool in_use)
+			{ _in_use = in_use; }
+
+			//Exchanges the wrapped allocators (heap blocks travel with them)
+			void	swap_base(Small_vector_allocator &x)
+			{
+				if (*this != x)
+					std::swap(static_cast<Base &>(*this), static_cast<Base &>(x));
+			}
+
+			template<typename U>
+			bool	operator==(const Small_vector_allocator<U, N, Alloc> &x) const
+			{ return (static_cast<const Base &>(*this) == static_cast<const typename Small_vector_allocator<U, N, Alloc>::Base &>(x)); }
+
+			template<typename U>
+			bool	operator!=(const Small_vector_allocator<U, N, Alloc> &x) const
+			{ return (!(*this == x)); }
+	};
+
+	//Heap blocks grow in place when the wrapped allocator can reallocate
+	template<typename T, size_t N, typename Alloc>
+	struct allocator_can_reallocate<Small_vector_allocator<T, N, Alloc> >
+		: public integral_constant<allocator_can_reallocate<typename Alloc::template rebind<T>::other>::value> {};
+
+	//ft::vector keeping up to N elements inside the object. It only touches
+	//Alloc once it outgrows the buffer, then behaves like ft::vector.
+	//Swapping with an inline vector copies the inline elements. The vector
+	//is a private base: swapping or assigning through a vector& would hand
+	//over pointers into the inline buffer
+	template<typename T, size_t N, typename Alloc = std::allocator<T> >
+	class small_vector : private ft::vector<T, Small_vector_allocator<T, N, Alloc> >
+	{
+		typedef ft::vector<T, Small_vector_allocator<T, N, Alloc> >	Base;
+
+		public:
+			typedef typename Base::value_type				value_type;
+			typedef typename Base::pointer					pointer;
+			typedef typename Base::const_pointer			const_pointer;
+			typedef typename Base::reference				reference;
+			typedef typename Base::const_reference			const_reference;
+			typedef typename Base::size_type				size_type;
+			typedef typename Base::difference_type			difference_type;
+			typedef typename Base::allocator_type			allocator_type;
+			typedef typename Base::iterator					iterator;
+			typedef typename Base::const_iterator			const_iterator;
+			typedef typename Base::reverse_iterator			reverse_iterator;
+			typedef typename Base::const_reverse_iterator	const_reverse_iterator;
+
+			using Base::get_allocator;
+			using Base::begin;
+			using Base::end;
+			using Base::rbegin;
+			using Base::rend;
+			using Base::size;
+			using Base::max_size;
+			using Base::resize;
+			using Base::resize_default_init;
+			using Base::capacity;
+			using Base::empty;
+			using Base::reserve;
+			using Base::at;
+			using Base::front;
+			using Base::back;
+			using Base::operator[];
+			using Base::assign;
+			using Base::push_back;
+			using Base::append;
+			using Base::pop_back;
+			using Base::insert;
+			using Base::erase;
+			using Base::clear;
+
+		private:
+			//Copies the elements of an inline vector into the (free) buffer of
+			//dst, which takes them over with capacity N
+			static void	_move_inline(small_vector &src, small_vector &dst)
+			{
+				pointer	buf = dst.Ft_impl.inline_data();
+				pointer	end = std::uninitialized_copy(src.Ft_impl.start, src.Ft_impl.finish, buf);
+
+				for (pointer p = src.Ft_impl.start; p != src.Ft_impl.finish; ++p)
+					src.Ft_impl.destroy(p);
+				src.Ft_impl.set_in_use(false);
+				dst.Ft_impl.set_in_use(true);
+				dst.Ft_impl.start = buf;
+				dst.Ft_impl.finish = end;
+				dst.Ft_impl.end_of_storage = buf + N;
+			}
+
+			//Brings the elements of a heap vector back to the (free) buffer
+			void	_to_inline()
+			{
+				pointer	buf = this->Ft_impl.inline_data();
+				pointer	end = std::uninitialized_copy(this->Ft_impl.start, this->Ft_impl.finish, buf);
+
+				this->clear();
+				this->Ft_impl.deallocate(this->Ft_impl.start, this->capacity());
+				this->Ft_impl.set_in_use(true);
+				this->Ft_impl.start = buf;
+				this->Ft_impl.finish = end;
+				this->Ft_impl.end_of_storage = buf + N;
+			}
+
+		public:
+			//////////////////////CONSTRUCTORS//////////////////
+			explicit small_vector(const Alloc &a = Alloc()) : Base(allocator_type(a))
+			{ this->reserve(N); }
+
+			explicit small_vector(size_type n, const value_type &value = value_type(),
+				const Alloc &a = Alloc()) : Base(allocator_type(a))
+			{
+				this->reserve(N);
+				this->assign(n, value);
+			}
+
+			template<typename Iterator>
+			small_vector(Iterator first, Iterator last, const Alloc &a = Alloc())
+				: Base(allocator_type(a))
+			{
+				this->reserve(N);
+				this->assign(first, last);
+			}
+
+			//Same wrapped allocator, free inline buffer
+			small_vector(const small_vector &src) : Base(src.get_allocator())
+			{
+				this->reserve(N);
+				this->assign(src.begin(), src.end());
+			}
+
+			small_vector	&operator=(const small_vector &src)
+			{
+				Base::operator=(src);
+				return (*this);
+			}
+
+			//True while the elements live in the inline buffer
+			bool	is_inline() const
+			{ return (this->Ft_impl.is_inline(this->Ft_impl.start)); }
+
+			//////////////////////CAPACITY////////////////////////
+			//Up to N elements go back to the inline buffer
+			void	shrink_to_fit()
+			{
+				if (is_inline())
+					return ;
+				if (this->size() <= N)
+					_to_inline();
+				else
+					Base::shrink_to_fit();
+			}
+
+			//////////////////////MODIFIERS////////////////////////
+			//Heap blocks are exchanged, inline elements are copied over. The
+			//wrapped allocators are always exchanged
+			void	swap(small_vector &x)
+			{
+				if (this == &x)
+					return ;
+				this->Ft_impl.swap_base(x.Ft_impl);
+				if (!is_inline() && !x.is_inline())
+				{
+					std::swap(this->Ft_impl.start, x.Ft_impl.start);
+					std::swap(this->Ft_impl.finish, x.Ft_impl.finish);
+					std::swap(this->Ft_impl.end_of_storage, x.Ft_impl.end_of_storage);
+				}
+				else if (is_inline() && x.is_inline())
+				{
+					small_vector	&longer = (this->size() < x.size() ? x : *this);
+					small_vector	&shorter = (this->size() < x.size() ? *this : x);
+					const size_type	common = shorter.size();
+
+					std::swap_ranges(longer.begin(), longer.begin() + common, shorter.begin());
+					shorter.append(longer.begin() + common, longer.end());
+					longer.erase(longer.begin() + common, longer.end());
+				}
+				else
+				{
+					small_vector	&inl = (is_inline() ? *this : x);
+					small_vector	&heap = (is_inline() ? x : *this);
+					pointer			start = heap.Ft_impl.start;
+					pointer			finish = heap.Ft_impl.finish;
+					pointer			end_of_storage = heap.Ft_impl.end_of_storage;
+
+					_move_inline(inl, heap);
+					inl.Ft_impl.start = start;
+					inl.Ft_impl.finish = finish;
+					inl.Ft_impl.end_of_storage = end_of_storage;
+				}
+			}
+	};
+
+	template<typename T, size_t N, typename Alloc>
+	inline bool	operator==(const small_vector<T, N, Alloc> &x, const small_vector<T, N, Alloc> &y)
+	{ return (x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin())); }
+
+	template<typename T, size_t N, typename Alloc>
+	inline bool	operator!=(const small_vector<T, N, Alloc> &x, const small_vector<T, N, Alloc> &y)
+	{ return (!(x == y)); }
+
+	template<typename T, size_t N, typename Alloc>
+	inline bool	operator<(const small_vector<T, N, Alloc> &x, const small_vector<T, N, Alloc> &y)
+	{ return (ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end())); }
+
+	template<typename T, size_t N, typename Alloc>
+	inline bool	operator>(const small_vector<T, N, Alloc> &x, const small_vector<T, N, Alloc> &y)
+	{ return (y < x); }
+
+	template<typename T, size_t N, typename Alloc>
+	inline bool	operator<=(const small_vector<T, N, Alloc> &x, const small_vector<T, N, Alloc> &y)
+	{ return (!(y < x)); }
+
+	template<typename T, size_t N, typename Alloc>
+	inline bool	operator>=(const small_vector<T, N, Alloc> &x, const small_vector<T, N, Alloc> &y)
+	{ return (!(x < y)); }
+
+	template<typename T, size_t N, typename Alloc>
+	inline void swap(small_vector<T, N, Alloc> &x, small_vector<T, N, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
@@ -1,11 +1,11 @@
 #ifndef STACK_HPP
 # define STACK_HPP
 
-# include "vector.hpp"
+# include "deque.hpp"
 
 namespace ft
 {
-	template<typename T, typename Container = ft::vector<T> >
+	template<typename T, typename Container = ft::deque<T> >
 	class stack
 	{
 		template<typename T1, typename C1>
@@ -43,6 +43,10 @@ namespace ft
 
 			void	pop()
 			{ c.pop_back(); }
+
+			//Only for containers providing shrink_to_fit (ft::vector, ft::deque)
+			void	shrink_to_fit()
+			{ c.shrink_to_fit(); }
 	};
 
 	template<typename T, typename C>
@@ -0,0 +1,195 @@
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+# include <functional>
+# include <memory>
+# include "ft_hashtable.hpp"
+# include "map.hpp"
+
+namespace ft
+{
+	//Hash map with open addressing (see ft_hashtable.hpp): insert, erase
+	//and rehash invalidate iterators, pointers and references
+	template
+	<
+		typename Key,
+		typename Value,
+		typename Hash = ft::hash<Key>,
+		typename Pred = std::equal_to<Key>,
+		typename Alloc = std::allocator<ft::pair <const Key, Value> >
+	>
+	class unordered_map
+	{
+		public:
+			typedef Key								key_type;
+			typedef	Value							mapped_type;
+			typedef ft::pair<const Key, Value>		value_type;
+			typedef Hash							hasher;
+			typedef Pred							key_equal;
+			typedef Alloc							allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef Hashtable<key_type, value_type, ft::Select1st<value_type>, hasher, key_equal, allocator_type>	_Hashtable;
+			_Hashtable _table;
+
+		public:
+			typedef typename _Hashtable::iterator							iterator;
+			typedef typename _Hashtable::const_iterator						const_iterator;
+			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+			typedef typename _Hashtable::size_type							size_type;
+
+			//CONSTRUCTORS, OPERATOR=
+
+			explicit unordered_map(size_type n = 0,
+				const hasher &hf = hasher(),
+				const key_equal &eq = key_equal(),
+				const allocator_type &alloc = allocator_type())
+				: _table(n, hf, eq, alloc) {}
+
+			unordered_map(const unordered_map &src) : _table(src._table) {}
+
+			template<typename Iterator>
+			unordered_map(Iterator first, Iterator last,
+				size_type n = 0,
+				const hasher &hf = hasher(),
+				const key_equal &eq = key_equal(),
+				const allocator_type &alloc = allocator_type())
+				: _table(n, hf, eq, alloc)
+			{ _table.insert_unique(first, last); }
+
+			unordered_map&	operator=(const unordered_map &src)
+			{
+				_table = src._table;
+				return (*this);
+			}
+			//ITERATORS
+			iterator begin()
+			{ return _table.begin(); }
+
+			const_iterator begin() const
+			{ return _table.begin(); }
+
+			iterator end()
+			{ return _table.end(); }
+
+			const_iterator end() const
+			{ return _table.end(); }
+
+			//CAPACITY
+			bool empty() const
+			{ return _table.empty(); }
+
+			size_type	max_size() const
+			{ return _table.max_size(); }
+
+			size_type	size() const
+			{ return _table.size(); }
+
+			//ELEMENT ACCESS
+			mapped_type&	operator[](const key_type &k)
+			{
+				iterator it = find(k);
+				if (it == end())
+					it = insert(value_type(k, mapped_type())).first;
+				return (*it).second;
+			}
+			//MODIFIERS
+			ft::pair<iterator,bool>	insert(const value_type &val)
+			{ return _table.insert_unique(val); }
+
+			//The hint is ignored
+			iterator	insert(iterator, const value_type &val)
+			{ return _table.insert_unique(val).first; }
+
+			template<typename Iterator>
+			void	insert(Iterator first, Iterator last)
+			{ _table.insert_unique(first, last); }
+
+			void	erase(iterator position)
+			{ _table.erase(position); }
+
+			size_type	erase(const key_type &k)
+			{ return _table.erase(k); }
+
+			void	erase(iterator first, iterator last)
+			{ _table.erase(first, last); }
+
+			void	swap(unordered_map &s)
+			{ _table.swap(s._table); }
+
+			void clear()
+			{ _table.clear(); }
+
+			//OBSERVERS
+			hasher	hash_function() const
+			{ return _table.hash_function(); }
+
+			key_equal	key_eq() const
+			{ return _table.key_eq(); }
+
+			//OPERATIONS
+			iterator find (const key_type &k)
+			{ return _table.find(k); }
+
+			const_iterator find (const key_type &k) const
+			{ return _table.find(k); }
+
+			size_type	count(const key_type &k) const
+			{ return _table.count(k); }
+
+			ft::pair<iterator, iterator>	equal_range(const key_type &k)
+			{ return _table.equal_range(k); }
+
+			ft::pair<const_iterator, const_iterator>	equal_range(const key_type &k) const
+			{ return _table.equal_range(k); }
+
+			//BUCKETS AND HASH POLICY
+			size_type	bucket_count() const
+			{ return _table.bucket_count(); }
+
+			float	load_factor() const
+			{ return _table.load_factor(); }
+
+			float	max_load_factor() const
+			{ return _table.max_load_factor(); }
+
+			void	max_load_factor(float z)
+			{ _table.max_load_factor(z); }
+
+			void	rehash(size_type n)
+			{ _table.rehash(n); }
+
+			//Room for n elements without rehashing
+			void	reserve(size_type n)
+			{ _table.reserve(n); }
+
+			//ALLOCATOR
+			allocator_type	get_allocator() const
+			{ return _table.get_allocator(); }
+
+			//Friend prototype to have access to private _table outside
+			template<typename K, typename T, typename H, typename P, typename A>
+			friend bool	operator==(const unordered_map<K, T, H, P, A>&, const unordered_map<K, T, H, P, A>&);
+	};
+
+	template<typename Key, typename Tp, typename Hash, typename Pred, typename Alloc>
+	inline bool operator==(const unordered_map<Key, Tp, Hash, Pred, Alloc> &x,
+		const unordered_map<Key, Tp, Hash, Pred, Alloc> &y)
+	{ return (x._table == y._table); }
+
+	template<typename Key, typename Tp, typename Hash, typename Pred, typename Alloc>
+	inline bool operator!=(const unordered_map<Key, Tp, Hash, Pred, Alloc> &x,
+		const unordered_map<Key, Tp, Hash, Pred, Alloc> &y)
+	{ return !(x == y); }
+
+	template<typename Key, typename Tp, typename Hash, typename Pred, typename Alloc>
+	inline void swap(unordered_map<Key, Tp, Hash, Pred, Alloc> &x, unordered_map<Key, Tp, Hash, Pred, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
@@ -0,0 +1,164 @@
+#ifndef UNORDERED_SET_HPP
+# define UNORDERED_SET_HPP
+
+# include <functional>
+# include <memory>
+# include "ft_iterator.hpp"
+# include "ft_hashtable.hpp"
+# include "set.hpp"
+
+namespace	ft
+{
+	//Hash set with open addressing (see ft_hashtable.hpp): insert, erase
+	//and rehash invalidate iterators, pointers and references
+	template
+	<
+		typename Key,
+		typename Hash = ft::hash<Key>,
+		typename Pred = std::equal_to<Key>,
+		typename Alloc = std::allocator<Key>
+	>
+	class unordered_set
+	{
+		public:
+			typedef Key		key_type;
+			typedef Key		value_type;
+			typedef Hash	hasher;
+			typedef Pred	key_equal;
+			typedef Alloc	allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef Hashtable<key_type, value_type, ft::Identity<value_type>, hasher, key_equal, allocator_type>	_Hashtable;
+			_Hashtable _table;
+		public:
+			typedef typename _Hashtable::const_iterator						iterator;
+			typedef typename _Hashtable::const_iterator						const_iterator;
+			typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+			typedef typename _Hashtable::size_type							size_type;
+		//Constructor and operator=
+		explicit	unordered_set(size_type n = 0, const hasher &hf = hasher(),
+			const key_equal &eq = key_equal(),
+			const allocator_type &alloc = allocator_type())
+			: _table(n, hf, eq, alloc) {}
+
+		template <typename It>
+		unordered_set(It first, It last, size_type n = 0,
+			const hasher &hf = hasher(),
+			const key_equal &eq = key_equal(),
+			const allocator_type &alloc = allocator_type())
+			: _table(n, hf, eq, alloc)
+		{ _table.insert_unique(first, last); }
+
+		unordered_set(const unordered_set &x) : _table(x._table) {}
+
+		unordered_set&	operator=(const unordered_set &src)
+		{
+			_table = src._table;
+			return *this;
+		}
+		//Accessors
+		hasher	hash_function() const
+		{ return _table.hash_function(); }
+
+		key_equal	key_eq() const
+		{ return _table.key_eq(); }
+
+		//Iterators
+		iterator	begin() const
+		{ return _table.begin(); }
+
+		iterator	end() const
+		{ return _table.end(); }
+		//Capacity
+		bool	empty() const
+		{ return _table.empty(); }
+
+		size_type	size() const
+		{ return _table.size(); }
+
+		size_type	max_size() const
+		{ return _table.max_size(); }
+		//Modifiers
+		void	swap(unordered_set &x)
+		{ _table.swap(x._table); }
+
+		ft::pair<iterator, bool>	insert(const value_type &val)
+		{ return _table.insert_unique(val); }
+
+		//The hint is ignored
+		iterator	insert(iterator, const value_type &val)
+		{ return _table.insert_unique(val).first; }
+
+		template<typename It>
+		void	insert(It first, It last)
+		{ _table.insert_unique(first, last); }
+
+		void	erase(iterator position)
+		{ _table.erase(position); }
+
+		size_type	erase(const value_type &val)
+		{ return _table.erase(val); }
+
+		void	erase(iterator first, iterator last)
+		{ _table.erase(first, last); }
+
+		void	clear()
+		{ _table.clear(); }
+		//Operations
+		iterator	find(const value_type &val) const
+		{ return _table.find(val); }
+
+		size_type	count(const value_type &val) const
+		{ return _table.count(val); }
+
+		ft::pair<iterator, iterator>	equal_range(const value_type &val) const
+		{ return _table.equal_range(val); }
+		//Buckets and hash policy
+		size_type	bucket_count() const
+		{ return _table.bucket_count(); }
+
+		float	load_factor() const
+		{ return _table.load_factor(); }
+
+		float	max_load_factor() const
+		{ return _table.max_load_factor(); }
+
+		void	max_load_factor(float z)
+		{ _table.max_load_factor(z); }
+
+		void	rehash(size_type n)
+		{ _table.rehash(n); }
+
+		//Room for n elements without rehashing
+		void	reserve(size_type n)
+		{ _table.reserve(n); }
+
+		//Allocator
+		allocator_type	get_allocator() const
+		{ return _table.get_allocator(); }
+		//Friend prototype to have access to private _table outside
+		template<typename K, typename H, typename P, typename A>
+		friend bool	operator==(const unordered_set<K, H, P, A>&, const unordered_set<K, H, P, A>&);
+	};
+
+	template<typename Key, typename Hash, typename Pred, typename Alloc>
+	inline bool operator==(const unordered_set<Key, Hash, Pred, Alloc> &x,
+		const unordered_set<Key, Hash, Pred, Alloc> &y)
+	{ return (x._table == y._table); }
+
+	template<typename Key, typename Hash, typename Pred, typename Alloc>
+	inline bool operator!=(const unordered_set<Key, Hash, Pred, Alloc> &x,
+		const unordered_set<Key, Hash, Pred, Alloc> &y)
+	{ return !(x == y); }
+
+	template<typename Key, typename Hash, typename Pred, typename Alloc>
+	inline void swap(unordered_set<Key, Hash, Pred, Alloc> &x, unordered_set<Key, Hash, Pred, Alloc> &y)
+	{ x.swap(y); }
+}
+
+#endif
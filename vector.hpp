@@ -5,9 +5,12 @@
 # include <algorithm>
 # include <memory>
 # include <iterator>
+# include <cstring>
+# include <new>
 # include "ft_iterator.hpp"
 # include "ft_normal_iterator.hpp"
 # include "ft_utilities.hpp"
+# include "ft_growth_policy.hpp"
 
 namespace ft
 {
@@ -68,11 +71,15 @@ namespace ft
     }
   };
 
-  template<typename Tp, typename Alloc = std::allocator<Tp> >
+  //Growth picks the capacity of reallocations (ft_growth_policy.hpp)
+  template<typename Tp, typename Alloc = std::allocator<Tp>, typename Growth = ft::growth_double>
   class vector : protected Ft_vector_base<Tp, Alloc>
   {
     typedef Ft_vector_base<Tp, Alloc>       Base;
     typedef typename Base::Tp_alloc_type    Tp_alloc_type;
+    typedef ft::integral_constant<ft::is_trivially_copyable<Tp>::value> Trivial;
+    typedef ft::integral_constant<ft::is_trivially_relocatable<Tp>::value
+      && ft::allocator_can_reallocate<Tp_alloc_type>::value>           Reallocate;
 
     public:
       typedef Tp                                                      value_type;
@@ -87,30 +94,104 @@ namespace ft
       typedef typename Tp_alloc_type::size_type                       size_type;
       typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
       typedef Alloc                                                   allocator_type;
+      typedef Growth                                                  growth_policy;
       protected:
         using Base::Ft_allocate;
         using Base::Ft_deallocate;
         using Base::Ft_impl;
         using Base::Ft_get_Tp_allocator;
+      public:
         using Base::get_allocator;
 
     private:
+      //////////////////////TRIVIALLY_COPYABLE_PATHS//////////////////
+      //Contiguous ranges of trivially copyable elements are copied with
+      //memcpy/memmove, other ranges go through the std algorithms
       template <typename Iterator>
-      Iterator _copy_n(Iterator first, size_type n, iterator result)
+      static Iterator _base(Iterator it)
+      { return (it); }
+
+      template <typename Ptr, typename Container>
+      static Ptr  _base(ft::normal_iterator<Ptr, Container> it)
+      { return (it.base()); }
+
+      //Copy constructs [first, last) to uninitialized memory at result
+      template <typename Iterator>
+      static pointer  _ucopy(Iterator first, Iterator last, pointer result)
+      { return (_ucopy_base(_base(first), _base(last), result)); }
+
+      template <typename Iterator>
+      static pointer  _ucopy_base(Iterator first, Iterator last, pointer result)
+      { return (std::uninitialized_copy(first, last, result)); }
+
+      static pointer  _ucopy_base(pointer first, pointer last, pointer result)
+      { return (_ucopy_ptr(first, last, result, Trivial())); }
+
+      static pointer  _ucopy_base(const_pointer first, const_pointer last, pointer result)
+      { return (_ucopy_ptr(first, last, result, Trivial())); }
+
+      static pointer  _ucopy_ptr(const_pointer first, const_pointer last, pointer result, true_type)
       {
-        while (n--)
-          *result++ = *first++;
-        return (first);
+        const size_type n = last - first;
+
+        if (n)
+          std::memcpy(static_cast<void *>(result), first, n * sizeof(value_type));
+        return (result + n);
       }
 
+      static pointer  _ucopy_ptr(const_pointer first, const_pointer last, pointer result, false_type)
+      { return (std::uninitialized_copy(first, last, result)); }
+
+      //Assigns [first, last) to the elements at result, ranges may overlap
+      //when result is before first
       template <typename Iterator>
-      void  _construct_n(Iterator first, size_type n, pointer result)
+      static pointer  _copy(Iterator first, Iterator last, pointer result)
+      { return (_copy_base(_base(first), _base(last), result)); }
+
+      template <typename Iterator>
+      static pointer  _copy_base(Iterator first, Iterator last, pointer result)
+      { return (std::copy(first, last, result)); }
+
+      static pointer  _copy_base(pointer first, pointer last, pointer result)
+      { return (_copy_ptr(first, last, result, Trivial())); }
+
+      static pointer  _copy_base(const_pointer first, const_pointer last, pointer result)
+      { return (_copy_ptr(first, last, result, Trivial())); }
+
+      static pointer  _copy_ptr(const_pointer first, const_pointer last, pointer result, true_type)
+      {
+        const size_type n = last - first;
+
+        if (n)
+          std::memmove(static_cast<void *>(result), first, n * sizeof(value_type));
+        return (result + n);
+      }
+
+      static pointer  _copy_ptr(const_pointer first, const_pointer last, pointer result, false_type)
+      { return (std::copy(first, last, result)); }
+
+      //Shifts the elements of [first, last) to end at result
+      static pointer  _copy_backward(pointer first, pointer last, pointer result)
+      { return (_copy_backward(first, last, result, Trivial())); }
+
+      static pointer  _copy_backward(pointer first, pointer last, pointer result, true_type)
       {
-        while (n--)
-          this->Ft_impl.construct(result++, *first++);
+        const size_type n = last - first;
+
+        if (n)
+          std::memmove(static_cast<void *>(result - n), first, n * sizeof(value_type));
+        return (result - n);
       }
 
+      static pointer  _copy_backward(pointer first, pointer last, pointer result, false_type)
+      { return (std::copy_backward(first, last, result)); }
+
       void _destroy(pointer first, pointer last)
+      { _destroy(first, last, Trivial()); }
+
+      void _destroy(pointer, pointer, true_type) {}
+
+      void _destroy(pointer first, pointer last, false_type)
       {
         while (first != last)
         {
@@ -119,12 +200,42 @@ namespace ft
         }
       }
 
+      //////////////////////GROWTH//////////////////
+      //Moves the elements to a block of n elements. Trivially relocatable
+      //elements let allocators with reallocate() extend the block in place
+      void  _grow(size_type n)
+      { _grow(n, Reallocate()); }
+
+      void  _grow(size_type n, true_type)
+      {
+        const size_type len = size();
+
+        this->Ft_impl.start = this->Ft_impl.reallocate(this->Ft_impl.start, capacity(), n);
+        this->Ft_impl.finish = this->Ft_impl.start + len;
+        this->Ft_impl.end_of_storage = this->Ft_impl.start + n;
+      }
+
+      void  _grow(size_type n, false_type)
+      {
+        pointer new_start = this->Ft_impl.allocate(n);
+        pointer new_finish = new_start + size();
+
+        _ucopy(this->Ft_impl.start, this->Ft_impl.finish, new_start);
+        _destroy(this->Ft_impl.start, this->Ft_impl.finish);
+        this->Ft_impl.deallocate(this->Ft_impl.start, this->Ft_impl.end_of_storage - this->Ft_impl.start);
+        this->Ft_impl.start = new_start;
+        this->Ft_impl.finish = new_finish;
+        this->Ft_impl.end_of_storage = new_start + n;
+      }
+
+      //Capacity for n more elements, as chosen by the growth policy
       size_type _new_size(size_type n)
       {
         if (max_size() - size() < n)
           throw std::length_error("length error\n");
-        const size_type len = size() + std::max(size(), n);
-        return ((len < size() || len > max_size()) ? max_size() : len);
+        const size_type required = size() + n;
+        const size_type len = Growth::grow(size(), required, sizeof(value_type));
+        return ((len < required || len > max_size()) ? max_size() : len);
       }
 
 
@@ -177,7 +288,7 @@ namespace ft
         {
           pointer new_start = this->Ft_allocate(len);
 
-          std::uninitialized_copy(first, last, new_start);
+          _ucopy(first, last, new_start);
           _destroy(this->Ft_impl.start, this->Ft_impl.finish);
           this->Ft_deallocate(this->Ft_impl.start, this->Ft_impl.end_of_storage - this->Ft_impl.start);
           this->Ft_impl.start = new_start;
@@ -185,14 +296,14 @@ namespace ft
           this->Ft_impl.end_of_storage = this->Ft_impl.finish;
         }
         else if (size() >= len)
-          erase(iterator(std::copy(first, last, this->Ft_impl.start)), end());
+          erase(iterator(_copy(first, last, this->Ft_impl.start)), end());
         else
         {
           ForwardIterator it = first;
 
           std::advance(it, size());
-          std::copy(first, it, this->Ft_impl.start);
-          this->Ft_impl.finish = std::uninitialized_copy(it, last, this->Ft_impl.finish);
+          _copy(first, it, this->Ft_impl.start);
+          this->Ft_impl.finish = _ucopy(it, last, this->Ft_impl.finish);
         }
       }
 
@@ -201,26 +312,36 @@ namespace ft
       {
         if (n)
         {
+          if (Reallocate::value && _free_n() < n)
+          {
+            const difference_type off = position - begin();
+
+            _grow(_new_size(n));
+            position = begin() + off;
+          }
           if (_free_n() >= n)
           {
             if (position == end())
-              std::uninitialized_copy(first, last, this->Ft_impl.finish);
+              _ucopy(first, last, this->Ft_impl.finish);
             else
             {
               const size_type els_after = end() - position;
               if (els_after > n)
               {
-                iterator tmp = position + els_after - n;
+                pointer tmp = this->Ft_impl.finish - n;
 
-                std::uninitialized_copy(tmp, end(), this->Ft_impl.finish);
-                std::copy_backward(position, tmp, end());
-                std::copy(first, last, position);
+                _ucopy(tmp, this->Ft_impl.finish, this->Ft_impl.finish);
+                _copy_backward(position.base(), tmp, this->Ft_impl.finish);
+                _copy(first, last, position.base());
               }
               else
               {
-                std::uninitialized_copy(position, end(), end() + (n - els_after));
-                Iterator tmp = _copy_n(first, els_after, position);
-                _construct_n(tmp, n - els_after, this->Ft_impl.finish);
+                Iterator mid = first;
+
+                std::advance(mid, els_after);
+                _ucopy(position, end(), this->Ft_impl.finish + (n - els_after));
+                _copy(first, mid, position.base());
+                _ucopy(mid, last, this->Ft_impl.finish);
               }
             }
             this->Ft_impl.finish += n;
@@ -229,12 +350,12 @@ namespace ft
           {
             size_type len = _new_size(n);
             pointer new_start = this->Ft_allocate(len);
-            pointer pos = std::uninitialized_copy(begin(), position, new_start);
+            pointer pos = _ucopy(begin(), position, new_start);
             pointer new_finish = 0;
 
-            std::uninitialized_copy(first, last, pos);
-             if (position < end())
-              new_finish = std::uninitialized_copy(position, end(), pos + n);
+            _ucopy(first, last, pos);
+            if (position < end())
+              new_finish = _ucopy(position, end(), pos + n);
             else
               new_finish = pos + n;
             _destroy(this->Ft_impl.start, this->Ft_impl.finish);
@@ -246,13 +367,65 @@ namespace ft
         }
       }
 
+      //Slow path of push_back: val may refer to an element of the vector,
+      //so it is copied before the old storage is released
+      FT_COLD void  _realloc_append(const value_type &val)
+      {
+        if (Reallocate::value)
+        {
+          const value_type copy(val);
+
+          _grow(_new_size(1));
+          this->Ft_impl.construct(this->Ft_impl.finish, copy);
+          ++this->Ft_impl.finish;
+          return ;
+        }
+        const size_type len = _new_size(1);
+        pointer new_start = this->Ft_allocate(len);
+        pointer new_finish = new_start;
+
+        try
+        {
+          new_finish = _ucopy(this->Ft_impl.start, this->Ft_impl.finish, new_start);
+          this->Ft_impl.construct(new_finish, val);
+        }
+        catch (...)
+        {
+          _destroy(new_start, new_finish);
+          this->Ft_deallocate(new_start, len);
+          throw;
+        }
+        _destroy(this->Ft_impl.start, this->Ft_impl.finish);
+        this->Ft_deallocate(this->Ft_impl.start, this->Ft_impl.end_of_storage - this->Ft_impl.start);
+        this->Ft_impl.start = new_start;
+        this->Ft_impl.finish = new_finish + 1;
+        this->Ft_impl.end_of_storage = new_start + len;
+      }
+
+      template<typename Iterator>
+      void  _append(Iterator first, Iterator last, std::input_iterator_tag)
+      {
+        for (; first != last; ++first)
+          push_back(*first);
+      }
+
+      template<typename Iterator>
+      void  _append(Iterator first, Iterator last, std::forward_iterator_tag)
+      {
+        const size_type n = std::distance(first, last);
+
+        if (_free_n() < n)
+          reserve(_new_size(n));
+        this->Ft_impl.finish = _ucopy(first, last, this->Ft_impl.finish);
+      }
+
       template<typename ForwardIterator>
       void  _range_initialize(ForwardIterator first, ForwardIterator last)
       {
         size_type n = std::distance(first, last);
 
         this->Ft_impl.start = Ft_allocate(n);
-        this->Ft_impl.finish = std::uninitialized_copy(first, last, this->Ft_impl.start);
+        this->Ft_impl.finish = _ucopy(first, last, this->Ft_impl.start);
         this->Ft_impl.end_of_storage = this->Ft_impl.finish;
       }
 
@@ -260,14 +433,21 @@ namespace ft
       {
         if (n > capacity())
         {
-          //vector  tmp(n, val);
-          //tmp.swap(*this);
-          _destroy(this->Ft_impl.start, this->Ft_impl.end_of_storage);
+          //Filled before the old elements go, val may be one of them
+          pointer new_start = this->Ft_allocate(n);
+
+          try
+          { std::uninitialized_fill(new_start, new_start + n, val); }
+          catch (...)
+          {
+            this->Ft_deallocate(new_start, n);
+            throw;
+          }
+          _destroy(this->Ft_impl.start, this->Ft_impl.finish);
           this->Ft_deallocate(this->Ft_impl.start, this->Ft_impl.end_of_storage - this->Ft_impl.start);
-          this->Ft_impl.start = this->Ft_allocate(n);
-          this->Ft_impl.finish = this->Ft_impl.start + n;
+          this->Ft_impl.start = new_start;
+          this->Ft_impl.finish = new_start + n;
           this->Ft_impl.end_of_storage = this->Ft_impl.finish;
-          std::uninitialized_fill(this->Ft_impl.start, this->Ft_impl.finish, val);
         }
         else
         {
@@ -291,25 +471,36 @@ namespace ft
       {
         if (n)
         {
+          if (Reallocate::value && _free_n() < n)
+          {
+            const value_type      copy(val);
+            const difference_type off = position - begin();
+
+            _grow(_new_size(n));
+            _fill_insert(begin() + off, n, copy);
+            return ;
+          }
           if (_free_n() >= n)
           {
             if(position == end())
               std::uninitialized_fill_n(this->Ft_impl.finish, n, val);
             else
             {
+              //val may be an element the shift moves
+              const value_type copy(val);
               const size_type els_after = ( end()) - position;
               if (els_after > n)
               {
-                iterator tmp = position + els_after - n;
-                std::uninitialized_copy(tmp, end(), this->Ft_impl.finish);
-                std::copy_backward(position, tmp, end());
-                std::fill(position, position + n, val);
+                pointer tmp = this->Ft_impl.finish - n;
+                _ucopy(tmp, this->Ft_impl.finish, this->Ft_impl.finish);
+                _copy_backward(position.base(), tmp, this->Ft_impl.finish);
+                std::fill(position, position + n, copy);
               }
               else
               {
-                std::uninitialized_copy(position, end(), end() + (n - els_after));
-                std::fill(position, position + els_after, val);
-                std::uninitialized_fill_n(this->Ft_impl.finish, (n - els_after), val);
+                _ucopy(position, end(), this->Ft_impl.finish + (n - els_after));
+                std::fill(position, position + els_after, copy);
+                std::uninitialized_fill_n(this->Ft_impl.finish, (n - els_after), copy);
               }
             }
             this->Ft_impl.finish += n;
@@ -318,12 +509,12 @@ namespace ft
           {
             size_type len = _new_size(n);
             pointer new_start = this->Ft_allocate(len);
-            pointer pos = std::uninitialized_copy(begin(), position, new_start);
+            pointer pos = _ucopy(begin(), position, new_start);
             pointer new_finish = 0;
 
             std::uninitialized_fill_n(pos, n, val);
             if (position < end())
-              new_finish = std::uninitialized_copy(position, end(), pos + n);
+              new_finish = _ucopy(position, end(), pos + n);
             else
               new_finish = pos + n;
             _destroy(this->Ft_impl.start, this->Ft_impl.finish);
@@ -349,7 +540,7 @@ namespace ft
 
       //Copy constructor
       vector(const vector& src) : Base(src.size(), src.Ft_get_Tp_allocator())
-      { this->Ft_impl.finish = std::uninitialized_copy(src.begin(), src.end(), this->Ft_impl.start); }
+      { this->Ft_impl.finish = _ucopy(src.begin(), src.end(), this->Ft_impl.start); }
 
       //Range constructor
       template<typename Iterator>
@@ -359,7 +550,7 @@ namespace ft
         _dispatch_initialize(first, last, Integral);
       }
 
-      vector<Tp, Alloc>& operator=(const vector<Tp, Alloc> &src)
+      vector& operator=(const vector &src)
       {
         if (&src != this)
         {
@@ -367,18 +558,18 @@ namespace ft
           if (src_len > capacity())
           {
             pointer tmp = this->Ft_allocate(src_len);
-            std::uninitialized_copy(src.begin(), src.end(), tmp);
+            _ucopy(src.begin(), src.end(), tmp);
             _destroy(this->Ft_impl.start, this->Ft_impl.finish);
             this->Ft_deallocate(this->Ft_impl.start,  this->Ft_impl.end_of_storage -  this->Ft_impl.start);
             this->Ft_impl.start = tmp;
             this->Ft_impl.end_of_storage = tmp + src_len;
           }
           else if (size() >= src_len)
-            _destroy(std::copy(src.begin(), src.end(), this->Ft_impl.start), this->Ft_impl.finish);
+            _destroy(_copy(src.begin(), src.end(), this->Ft_impl.start), this->Ft_impl.finish);
           else
           {
-            std::copy(src.begin(), src.begin() + size(), this->Ft_impl.start);
-            std::uninitialized_copy(src.begin() + size(), src.end(), this->Ft_impl.finish);
+            _copy(src.begin(), src.begin() + size(), this->Ft_impl.start);
+            _ucopy(src.begin() + size(), src.end(), this->Ft_impl.finish);
           }
           this->Ft_impl.finish = this->Ft_impl.start + src_len;
         }
@@ -430,6 +621,36 @@ namespace ft
           erase(begin() + n, end());
       }
 
+      //resize() with default-initialized new elements: class types run their
+      //default constructor, trivial types are left unwritten (and the pages
+      //untouched), for buffers that are filled right after (read()...)
+      void resize_default_init (size_type n)
+      {
+        const size_type len = size();
+
+        if (n < len)
+          erase(begin() + n, end());
+        else if (n > len)
+        {
+          if (_free_n() < n - len)
+            _grow(_new_size(n - len));
+
+          pointer cur = this->Ft_impl.finish;
+
+          try
+          {
+            for (; cur != this->Ft_impl.start + n; ++cur)
+              ::new(static_cast<void *>(cur)) value_type;
+          }
+          catch (...)
+          {
+            _destroy(this->Ft_impl.finish, cur);
+            throw;
+          }
+          this->Ft_impl.finish = cur;
+        }
+      }
+
       size_type capacity() const
       { return size_type(this->Ft_impl.end_of_storage - this->Ft_impl.start); }
 
@@ -442,16 +663,25 @@ namespace ft
           throw std::length_error("vector::reserve");
         if (capacity() < n)
         {
-          pointer new_start = this->Ft_impl.allocate(n);
-          pointer new_finish = new_start + size();
+          const size_type len = Growth::round_up(n, sizeof(value_type));
+          _grow((len < n || len > max_size()) ? max_size() : len);
+        }
+      }
 
-          std::uninitialized_copy(this->Ft_impl.start, this->Ft_impl.finish, new_start);
-          _destroy(this->Ft_impl.start, this->Ft_impl.finish);
-          this->Ft_impl.deallocate(this->Ft_impl.start, this->Ft_impl.end_of_storage - this->Ft_impl.start);
-          this->Ft_impl.start = new_start;
-          this->Ft_impl.finish = new_finish;
-          this->Ft_impl.end_of_storage = new_start + n;
+      //Reallocates to exactly size() elements, an empty vector frees its block
+      void shrink_to_fit()
+      {
+        if (capacity() == size())
+          return ;
+        if (empty())
+        {
+          this->Ft_deallocate(this->Ft_impl.start, capacity());
+          this->Ft_impl.start = 0;
+          this->Ft_impl.finish = 0;
+          this->Ft_impl.end_of_storage = 0;
         }
+        else
+          _grow(size());
       }
       //////////////////////ELEMENT_ACCESS////////////////////////
       reference at(size_type n)
@@ -498,8 +728,27 @@ namespace ft
         _dispatch_assign(first, last, Integral);
       }
 
+      //Only the capacity check is inlined in callers, reallocation is cold
       void push_back (const value_type& val)
-      { insert(end(), val); }
+      {
+        if (this->Ft_impl.finish != this->Ft_impl.end_of_storage)
+        {
+          this->Ft_impl.construct(this->Ft_impl.finish, val);
+          ++this->Ft_impl.finish;
+        }
+        else
+          _realloc_append(val);
+      }
+
+      //Appends [first, last), forward ranges grow the storage at most once.
+      //The range must not point into the vector
+      template <class InputIterator>
+      void append (InputIterator first, InputIterator last)
+      {
+        typedef typename ft::iterator_traits<InputIterator>::iterator_category category;
+
+        _append(first, last, category());
+      }
 
       void  pop_back()
       {
@@ -521,17 +770,24 @@ namespace ft
           else
           {
             this->Ft_impl.construct(this->Ft_impl.finish, *(this->Ft_impl.finish - 1));
-            std::copy_backward(position, end() - 1, end());
+            _copy_backward(position.base(), this->Ft_impl.finish - 1, this->Ft_impl.finish);
             *position = val;
             ++this->Ft_impl.finish;
           }
         }
+        else if (Reallocate::value)
+        {
+          const value_type copy(val);
+
+          _grow(_new_size(1));
+          insert(begin() + n, copy);
+        }
         else
         {
           size_type ns = _new_size(1);
           pointer new_start = this->Ft_impl.allocate(ns);
-          pointer tmp = std::uninitialized_copy(begin(), position, new_start);
-          pointer new_finish = std::uninitialized_copy(position, end(), tmp + 1);
+          pointer tmp = _ucopy(begin(), position, new_start);
+          pointer new_finish = _ucopy(position, end(), tmp + 1);
 
           this->Ft_impl.construct(tmp, val);
           _destroy(this->Ft_impl.start, this->Ft_impl.finish);
@@ -557,7 +813,7 @@ namespace ft
       iterator erase (iterator position)
       {
         if(position + 1 != end())
-          std::copy(position + 1, end(), position);
+          _copy(position + 1, end(), position.base());
         --this->Ft_impl.finish;
         this->Ft_impl.destroy(this->Ft_impl.finish);
         return position;
@@ -565,29 +821,12 @@ namespace ft
 
       iterator erase (iterator first, iterator last)
       {
-        size_type els_after;
-        size_type range_len;
-        pointer   tmp;
-
         if (first != end() && first != last)
         {
-          range_len = size_type(last - first);
+          pointer new_finish = _copy(last.base(), this->Ft_impl.finish, first.base());
 
-          if (last == end())
-            _destroy(first.base(), this->Ft_impl.finish);
-          else
-          {
-            tmp = last.base();
-            els_after = (end() - last);
-
-            std::copy(last.base(), this->Ft_impl.finish, first);
-            if (range_len > els_after)
-              tmp -= els_after;
-            else if (range_len < els_after)
-              tmp += (els_after - range_len);
-            _destroy(tmp, this->Ft_impl.finish);
-          }
-          this->Ft_impl.finish -= range_len;
+          _destroy(new_finish, this->Ft_impl.finish);
+          this->Ft_impl.finish = new_finish;
         }
         return (first);
       }
@@ -608,32 +847,32 @@ namespace ft
       }
   };
 
-  template<typename T, typename Allo>
-  inline bool operator==(const vector<T, Allo> &x, const vector<T, Allo> &y)
+  template<typename T, typename Allo, typename G>
+  inline bool operator==(const vector<T, Allo, G> &x, const vector<T, Allo, G> &y)
   { return (x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin())); }
 
-  template<typename T, typename Allo>
-  inline bool operator!=(const vector<T, Allo> &x, const vector<T, Allo> &y)
+  template<typename T, typename Allo, typename G>
+  inline bool operator!=(const vector<T, Allo, G> &x, const vector<T, Allo, G> &y)
   { return !(x == y); }
 
-  template<typename T, typename Allo>
-  inline bool operator<(const vector<T, Allo> &x, const vector<T, Allo> &y)
+  template<typename T, typename Allo, typename G>
+  inline bool operator<(const vector<T, Allo, G> &x, const vector<T, Allo, G> &y)
   { return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()); }
 
-  template<typename T, typename Allo>
-  inline bool operator>(const vector<T, Allo> &x, const vector<T, Allo> &y)
+  template<typename T, typename Allo, typename G>
+  inline bool operator>(const vector<T, Allo, G> &x, const vector<T, Allo, G> &y)
   { return (y < x); }
 
-  template<typename T, typename Allo>
-  inline bool operator<=(const vector<T, Allo> &x, const vector<T, Allo> &y)
+  template<typename T, typename Allo, typename G>
+  inline bool operator<=(const vector<T, Allo, G> &x, const vector<T, Allo, G> &y)
   { return !(y < x); }
 
-  template<typename T, typename Allo>
-  inline bool operator>=(const vector<T, Allo> &x, const vector<T, Allo> &y)
+  template<typename T, typename Allo, typename G>
+  inline bool operator>=(const vector<T, Allo, G> &x, const vector<T, Allo, G> &y)
   { return !(x < y); }
 
-  template<typename T, typename Allo>
-  inline void swap(vector<T, Allo> &x, vector<T, Allo> &y)
+  template<typename T, typename Allo, typename G>
+  inline void swap(vector<T, Allo, G> &x, vector<T, Allo, G> &y)
   { x.swap(y); }
 
 }